@@ -0,0 +1,121 @@
+#include <chrono>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "NewMap.hpp"
+
+// Meshes the same map with 1 to n threads, and always with 2 and 4 threads even on fewer cores.
+// Every run has to give the same buffers as the serial one, after a full meshing and after
+// a local remeshing of a few explosions, otherwise the benchmark fails.
+
+void fillMap(VoxelMap &map) {
+
+	const std::array<unsigned int, 3> size{map.getWorldDimensions()};
+
+	for(unsigned int x{0}; x < size[0]; x++) {
+		for(unsigned int y{0}; y < size[1]; y++) {
+
+			const unsigned int height{(x*7 + y*3) % size[2]};
+
+			for(unsigned int z{0}; z <= height; z++) {
+
+				map.setColor(x, y, z, z == height ? glm::vec4{0.24f, 0.56f, 0.1f, 1.f} : glm::vec4{0.56f, 0.24f, 0.05f*(z % 3), 1.f});
+			}
+		}
+	}
+
+	// Half of the chunks use the greedy mesher
+
+	for(unsigned int chunk{0}; chunk < map.getNbChunks(); chunk += 2) { map.setChunkMeshing(chunk, VoxelMeshing::Greedy); }
+}
+
+std::vector<std::pair<unsigned int, Gg::Component::VoxelMesh*>> getChunks(std::vector<Gg::Component::VoxelMesh> &meshes, const VoxelMap &map) {
+
+	std::vector<std::pair<unsigned int, Gg::Component::VoxelMesh*>> chunks;
+
+	for(unsigned int chunk: map.getDirtyChunks()) { chunks.emplace_back(chunk, &meshes[chunk]); }
+	return chunks;
+}
+
+bool sameMeshes(const std::vector<Gg::Component::VoxelMesh> &first, const std::vector<Gg::Component::VoxelMesh> &second) {
+
+	for(size_t i{0}; i < first.size(); i++) {
+
+		if(first[i].m_vertices.size() != second[i].m_vertices.size() || first[i].m_shortIndices != second[i].m_shortIndices
+		|| first[i].m_longIndices != second[i].m_longIndices) { return false; }
+
+		for(size_t j{0}; j < first[i].m_vertices.size(); j++) {
+
+			if(first[i].m_vertices[j].position != second[i].m_vertices[j].position || first[i].m_vertices[j].color != second[i].m_vertices[j].color) { return false; }
+		}
+	}
+
+	return true;
+}
+
+template<typename Function>
+double measure(Function function) {
+
+	std::chrono::time_point<std::chrono::steady_clock> start{std::chrono::steady_clock::now()};
+	function();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+
+	unsigned int maxThreads{std::max(std::thread::hardware_concurrency(), 1u)};
+	if(argc > 1) { maxThreads = static_cast<unsigned int>(std::stoul(argv[1])); }
+
+	VoxelMap reference{200, 600, 40};
+	fillMap(reference);
+
+	std::cout << "200x600x40 map, " << reference.getNbChunks() << " chunks" << std::endl;
+
+	std::vector<Gg::Component::VoxelMesh> serialMeshes, serialRemeshes;
+	bool allSame{true};
+	double single{0.0};
+
+	std::vector<unsigned int> threadCounts{1, 2, 4};
+	for(unsigned int nbThreads{3}; nbThreads <= maxThreads; nbThreads++) { if(nbThreads != 4) { threadCounts.emplace_back(nbThreads); } }
+	std::sort(threadCounts.begin(), threadCounts.end());
+
+	for(unsigned int nbThreads: threadCounts) {
+
+		// The calling thread takes part, so n threads means n - 1 workers
+
+		Gg::JobSystem jobSystem{nbThreads - 1};
+		VoxelMap map{reference};
+		std::vector<Gg::Component::VoxelMesh> meshes(map.getNbChunks(), Gg::Component::VoxelMesh{0});
+
+		double time{measure([&]() { meshChunks(jobSystem, map, getChunks(meshes, map)); })};
+		std::vector<Gg::Component::VoxelMesh> fullMeshes{meshes};
+
+		map.explode(31, 32, 20, 5);
+		map.explode(150, 500, 33, 4);
+		map.explode(100, 300, 10, 6);
+
+		double remeshTime{measure([&]() { meshChunks(jobSystem, map, getChunks(meshes, map)); })};
+
+		bool same{true};
+
+		if(nbThreads == 1) {
+
+			single = time;
+			serialMeshes.swap(fullMeshes);
+			serialRemeshes.swap(meshes);
+		}
+
+		else { same = sameMeshes(fullMeshes, serialMeshes) && sameMeshes(meshes, serialRemeshes); }
+
+		allSame = allSame && same;
+
+		std::cout << "    " << nbThreads << " thread(s): " << time << " ms (x" << single/time << "), remeshing " << remeshTime << " ms";
+		std::cout << (same ? "" : " RESULT MISMATCH") << std::endl;
+	}
+
+	std::cout << (allSame ? "PASSED" : "FAILED") << ": every run against the serial buffers" << std::endl;
+
+	return allSame ? 0 : 1;
+}
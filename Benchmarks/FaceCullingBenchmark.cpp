@@ -0,0 +1,92 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "Components/VoxelFaceCulling.hpp"
+
+// Culls every chunk of the same map with each kernel the CPU supports. All of them have to give
+// the masks of the scalar one.
+
+void fillMap(VoxelMap &map) {
+
+	const std::array<unsigned int, 3> size{map.getWorldDimensions()};
+
+	for(unsigned int x{0}; x < size[0]; x++) {
+		for(unsigned int y{0}; y < size[1]; y++) {
+
+			const unsigned int height{(x*7 + y*3) % size[2]};
+
+			for(unsigned int z{0}; z <= height; z++) {
+
+				// Some holes, so the faces aren't all on the surface
+				if((x*13 + y*5 + z*11) % 17 != 0) { map.setColor(x, y, z, glm::vec4{0.56f, 0.24f, 0.05f, 1.f}); }
+			}
+		}
+	}
+}
+
+std::vector<std::uint32_t> cullMap(VoxelFaceCulling &culling, const VoxelMap &map) {
+
+	std::vector<std::uint32_t> faces;
+	faces.reserve(map.getNbChunks()*6*VoxelMap::ChunkSize*VoxelMap::ChunkSize);
+
+	for(unsigned int chunk{0}; chunk < map.getNbChunks(); chunk++) {
+
+		culling.cull(map, chunk);
+
+		for(unsigned int direction{0}; direction < 6; direction++) {
+			for(unsigned int x{0}; x < VoxelMap::ChunkSize; x++) {
+				for(unsigned int y{0}; y < VoxelMap::ChunkSize; y++) { faces.emplace_back(culling.getFaces(direction, x, y)); }
+			}
+		}
+	}
+
+	return faces;
+}
+
+int main(int argc, char **argv) {
+
+	unsigned int nbRuns{20};
+	if(argc > 1) { nbRuns = static_cast<unsigned int>(std::stoul(argv[1])); }
+
+	VoxelMap map{200, 600, 80};
+	fillMap(map);
+
+	std::cout << "200x600x80 map, " << map.getNbChunks() << " chunks, " << nbRuns << " runs" << std::endl;
+
+	const std::vector<std::pair<VoxelFaceCulling::Kernel, std::string>> kernels{{VoxelFaceCulling::Kernel::Scalar, "scalar"},
+	                                                                             {VoxelFaceCulling::Kernel::SSE2, "SSE2"},
+	                                                                             {VoxelFaceCulling::Kernel::AVX2, "AVX2"}};
+
+	VoxelFaceCulling culling;
+	culling.setKernel(VoxelFaceCulling::Kernel::Scalar);
+	const std::vector<std::uint32_t> reference{cullMap(culling, map)};
+
+	bool allSame{true};
+
+	for(const std::pair<VoxelFaceCulling::Kernel, std::string> &kernel: kernels) {
+
+		if(!VoxelFaceCulling::isSupported(kernel.first)) {
+
+			std::cout << "    " << kernel.second << ": not supported" << std::endl;
+			continue;
+		}
+
+		culling.setKernel(kernel.first);
+
+		std::chrono::time_point<std::chrono::steady_clock> start{std::chrono::steady_clock::now()};
+
+		for(unsigned int run{0}; run < nbRuns; run++) {
+			for(unsigned int chunk{0}; chunk < map.getNbChunks(); chunk++) { culling.cull(map, chunk); }
+		}
+
+		const double time{std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()/nbRuns};
+		const bool same{cullMap(culling, map) == reference};
+		allSame = allSame && same;
+
+		std::cout << "    " << kernel.second << ": " << time << " ms per map" << (same ? "" : " RESULT MISMATCH") << std::endl;
+	}
+
+	return allSame ? 0 : 1;
+}
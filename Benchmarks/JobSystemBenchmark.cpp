@@ -0,0 +1,105 @@
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "GulgEngine/JobSystem.hpp"
+
+// Same integration as UpdateForces, on plain arrays.
+
+struct Body {
+
+	float position[3], velocity[3], forces[3];
+	float mass, maxSpeed, gravity;
+};
+
+void integrate(Body &body) {
+
+	for(unsigned int i{0}; i < 3; i++) {
+
+		body.velocity[i] += body.forces[i]/body.mass;
+		body.position[i] += body.velocity[i];
+	}
+
+	const float speed{std::sqrt(body.velocity[0]*body.velocity[0] + body.velocity[1]*body.velocity[1])};
+
+	if(speed > body.maxSpeed) {
+
+		body.velocity[0] *= body.maxSpeed/speed;
+		body.velocity[1] *= body.maxSpeed/speed;
+	}
+
+	body.forces[0] = 0.f;
+	body.forces[1] = 0.f;
+	body.forces[2] = body.gravity;
+}
+
+std::vector<Body> makeBodies(const size_t nbBodies) {
+
+	std::vector<Body> bodies(nbBodies);
+
+	for(size_t i{0}; i < nbBodies; i++) {
+
+		bodies[i] = Body{{0.f, 0.f, 0.f}, {0.f, 0.f, 0.f}, {static_cast<float>(i % 7), static_cast<float>(i % 5), 1.f}, 1.f + (i % 3), 2.f, -0.1f};
+	}
+
+	return bodies;
+}
+
+template<typename Function>
+double measure(Function function) {
+
+	std::chrono::time_point<std::chrono::steady_clock> start{std::chrono::steady_clock::now()};
+	function();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void benchmark(const unsigned int maxThreads, const size_t nbBodies, const size_t chunkSize, const unsigned int nbFrames) {
+
+	std::cout << nbBodies << " bodies, " << nbFrames << " frames, chunks of " << chunkSize << std::endl;
+
+	std::vector<Body> reference{makeBodies(nbBodies)};
+	for(unsigned int frame{0}; frame < nbFrames; frame++) { for(Body &body: reference) { integrate(body); } }
+
+	double single{0.0};
+
+	for(unsigned int nbThreads{1}; nbThreads <= maxThreads; nbThreads++) {
+
+		// The calling thread takes part, so n threads means n - 1 workers
+
+		Gg::JobSystem jobSystem{nbThreads - 1};
+		std::vector<Body> bodies{makeBodies(nbBodies)};
+
+		double time{measure([&]() {
+
+			for(unsigned int frame{0}; frame < nbFrames; frame++) {
+
+				jobSystem.parallelFor(bodies.size(), chunkSize, [&bodies](const size_t begin, const size_t end) {
+
+					for(size_t i{begin}; i < end; i++) { integrate(bodies[i]); }
+				});
+			}
+		})};
+
+		if(nbThreads == 1) { single = time; }
+
+		bool same{true};
+		for(size_t i{0}; i < nbBodies; i++) { same = same && bodies[i].position[2] == reference[i].position[2]; }
+
+		std::cout << "    " << nbThreads << " thread(s): " << time << " ms (x" << single/time << ")";
+		std::cout << (same ? "" : " RESULT MISMATCH") << std::endl;
+	}
+}
+
+int main(int argc, char **argv) {
+
+	unsigned int maxThreads{std::max(std::thread::hardware_concurrency(), 1u)};
+	if(argc > 1) { maxThreads = static_cast<unsigned int>(std::stoul(argv[1])); }
+
+	benchmark(maxThreads, 1000000, 4096, 50);
+	benchmark(maxThreads, 1000000, 64, 50);
+	benchmark(maxThreads, 1000, 64, 5000);
+
+	return 0;
+}
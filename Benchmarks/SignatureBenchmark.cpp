@@ -0,0 +1,132 @@
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+
+#include "GulgEngine/Signature.hpp"
+
+// Copy of the previous std::vector<bool> signature, restricted to what System::addEntity uses.
+
+class LegacySignature {
+
+	public:
+
+		LegacySignature(const size_t signatureSize): m_signature(signatureSize, false) {}
+		LegacySignature(const std::vector<bool> sign): m_signature{sign} {}
+
+		bool operator==(const LegacySignature &second) const {
+
+			if(m_signature.size() != second.m_signature.size()) { return false; }
+			for(size_t i{0}; i < m_signature.size(); i++) { if(m_signature[i] != second.m_signature[i]) { return false; } }
+			return true;
+		}
+
+		LegacySignature operator&(const LegacySignature &second) const {
+
+			std::vector<bool> newSignature{m_signature};
+			for(size_t i{0}; i < m_signature.size(); i++) { newSignature[i] = m_signature[i] & second.m_signature[i]; }
+			return LegacySignature{newSignature};
+		}
+
+		void operator+=(const LegacySignature &second) {
+
+			for(size_t i{0}; i < m_signature.size(); i++) { m_signature[i] = m_signature[i] | second.m_signature[i]; }
+		}
+
+		void changeBit(const size_t bit, const bool value) { m_signature[bit] = value; }
+
+	private:
+
+		std::vector<bool> m_signature;
+};
+
+template<typename SignatureType>
+std::vector<SignatureType> randomSignatures(const size_t number, const size_t size, const unsigned int bitsPerSignature, std::default_random_engine &engine) {
+
+	std::vector<SignatureType> result;
+	std::uniform_int_distribution<size_t> bitDistribution{0, size - 1};
+
+	for(size_t i{0}; i < number; i++) {
+
+		SignatureType current{size};
+		for(unsigned int j{0}; j < bitsPerSignature; j++) { current.changeBit(bitDistribution(engine), true); }
+		result.emplace_back(current);
+	}
+
+	return result;
+}
+
+template<typename Function>
+double measure(Function function) {
+
+	std::chrono::time_point<std::chrono::steady_clock> start{std::chrono::steady_clock::now()};
+	function();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void benchmark(const size_t signatureSize, const size_t nbEntities, const size_t nbAlgorithms) {
+
+	std::default_random_engine legacyEngine{42}, newEngine{42};
+
+	std::vector<LegacySignature> legacyEntities{randomSignatures<LegacySignature>(nbEntities, signatureSize, 5, legacyEngine)};
+	std::vector<LegacySignature> legacyAlgorithms{randomSignatures<LegacySignature>(nbAlgorithms, signatureSize, 2, legacyEngine)};
+
+	std::vector<Gg::Signature> entities{randomSignatures<Gg::Signature>(nbEntities, signatureSize, 5, newEngine)};
+	std::vector<Gg::Signature> algorithms{randomSignatures<Gg::Signature>(nbAlgorithms, signatureSize, 2, newEngine)};
+
+	size_t legacyMatches{0}, matches{0}, legacyCopies{0}, copies{0};
+
+	// What System::addEntity does for every spawned entity and every algorithm
+
+	double legacySubset{measure([&]() {
+
+		for(const LegacySignature &entity: legacyEntities) {
+			for(const LegacySignature &algorithm: legacyAlgorithms) { if((entity & algorithm) == algorithm) { legacyMatches++; } }
+		}
+	})};
+
+	double subset{measure([&]() {
+
+		for(const Gg::Signature &entity: entities) {
+			for(const Gg::Signature &algorithm: algorithms) { if(entity.contains(algorithm)) { matches++; } }
+		}
+	})};
+
+	// What getEntitySignature used to do: copy by value, then add a component
+
+	double legacyCopy{measure([&]() {
+
+		for(const LegacySignature &entity: legacyEntities) {
+
+			LegacySignature copy{entity};
+			copy += legacyAlgorithms[0];
+			if(copy == entity) { legacyCopies++; }
+		}
+	})};
+
+	double copy{measure([&]() {
+
+		for(const Gg::Signature &entity: entities) {
+
+			Gg::Signature current{entity};
+			current += algorithms[0];
+			if(current == entity) { copies++; }
+		}
+	})};
+
+	std::cout << "Signature size " << signatureSize << ", " << nbEntities << " entities x " << nbAlgorithms << " algorithms" << std::endl;
+	std::cout << "    subset test: " << legacySubset << " ms -> " << subset << " ms (x" << legacySubset/subset << ")";
+	std::cout << (legacyMatches == matches ? "" : " RESULT MISMATCH") << std::endl;
+	std::cout << "    copy and add: " << legacyCopy << " ms -> " << copy << " ms (x" << legacyCopy/copy << ")";
+	std::cout << (legacyCopies == copies ? "" : " RESULT MISMATCH") << std::endl;
+}
+
+int main() {
+
+	benchmark(11, 200000, 12);
+	benchmark(64, 200000, 12);
+	benchmark(256, 100000, 12);
+	benchmark(512, 50000, 12);
+
+	return 0;
+}
@@ -0,0 +1,263 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include "NewMap.hpp"
+
+// Meshes every chunk of the same map with a copy of the previous path, which listed the 6 faces
+// of each voxel, kept the visible ones and then copied them into the mesh, and with worldMapToMesh.
+// Each path runs in its own process, so that the peak RSS of one doesn't hide the other.
+
+namespace Previous {
+
+std::vector<std::pair<unsigned int, glm::vec3>> voxelsAndOrientations(const std::vector<unsigned int> &voxels) {
+
+	std::vector<std::pair<unsigned int, glm::vec3>> result;
+	result.reserve(voxels.size()*6);
+
+	for(unsigned int voxel: voxels) {
+
+		result.emplace_back(std::make_pair(voxel, glm::vec3{1.f, 0.f, 0.f}));
+		result.emplace_back(std::make_pair(voxel, glm::vec3{-1.f, 0.f, 0.f}));
+		result.emplace_back(std::make_pair(voxel, glm::vec3{0.f, 1.f, 0.f}));
+		result.emplace_back(std::make_pair(voxel, glm::vec3{0.f, -1.f, 0.f}));
+		result.emplace_back(std::make_pair(voxel, glm::vec3{0.f, 0.f, 1.f}));
+		result.emplace_back(std::make_pair(voxel, glm::vec3{0.f, 0.f, -1.f}));
+	}
+
+	return result;
+}
+
+std::vector<std::pair<unsigned int, glm::vec3>> selectVisibleFaces(const VoxelMap &map, const std::vector<std::pair<unsigned int, glm::vec3>> &facesToSelect) {
+
+	std::vector<std::pair<unsigned int, glm::vec3>> result;
+	result.reserve(facesToSelect.size());
+
+	const std::array<unsigned int, 3> worldSize{map.getWorldDimensions()};
+
+	for(const std::pair<unsigned int, glm::vec3> &currentFace: facesToSelect) {
+
+		if(!map.isSolid(currentFace.first)) { continue; }
+
+		const glm::vec3 testingFace{map.getVoxelPosition(currentFace.first) + currentFace.second};
+
+		if(testingFace.x < 0.f || testingFace.x >= worldSize[0]
+		|| testingFace.y < 0.f || testingFace.y >= worldSize[1]
+		|| testingFace.z < 0.f || testingFace.z >= worldSize[2]
+		|| !map.isSolid(testingFace.x, testingFace.y, testingFace.z)) { result.emplace_back(currentFace); }
+	}
+
+	return result;
+}
+
+std::array<unsigned int, 4> getPointsOfOrientedFace(const glm::vec3 &orientation) {
+
+	std::array<unsigned int, 4> quad;
+
+	if(orientation[0] == 1.f) {  quad[0] = 1; quad[1] = 5; quad[2] = 6; quad[3] = 2; }
+	if(orientation[0] == -1.f) { quad[0] = 0; quad[1] = 3; quad[2] = 7; quad[3] = 4; }
+	if(orientation[1] == 1.f) {  quad[0] = 4; quad[1] = 7; quad[2] = 6; quad[3] = 5; }
+	if(orientation[1] == -1.f) { quad[0] = 0; quad[1] = 1; quad[2] = 2; quad[3] = 3; }
+	if(orientation[2] == 1.f) {  quad[0] = 3; quad[1] = 7; quad[2] = 6; quad[3] = 2; }
+	if(orientation[2] == -1.f) { quad[0] = 0; quad[1] = 4; quad[2] = 5; quad[3] = 1; }
+
+	return quad;
+}
+
+glm::vec3 getPositionOfPoint(const VoxelMap &map, const unsigned int voxelID, const unsigned int point) {
+
+	glm::vec3 centerPosition{map.getVoxelPosition(voxelID)};
+
+	if(point == 0) { centerPosition += glm::vec3{-0.5f, -0.5f, -0.5f}; }
+	if(point == 1) { centerPosition += glm::vec3{0.5f, -0.5f, -0.5f}; }
+	if(point == 2) { centerPosition += glm::vec3{0.5f, -0.5f, 0.5f}; }
+	if(point == 3) { centerPosition += glm::vec3{-0.5f, -0.5f, 0.5f}; }
+	if(point == 4) { centerPosition += glm::vec3{-0.5f, 0.5f, -0.5f}; }
+	if(point == 5) { centerPosition += glm::vec3{0.5f, 0.5f, -0.5f}; }
+	if(point == 6) { centerPosition += glm::vec3{0.5f, 0.5f, 0.5f}; }
+	if(point == 7) { centerPosition += glm::vec3{-0.5f, 0.5f, 0.5f}; }
+
+	return centerPosition;
+}
+
+unsigned int getDirectionIndex(const glm::vec3 &orientation) {
+
+	if(orientation[0] == 1.f) { return 0; }
+	if(orientation[0] == -1.f) { return 1; }
+	if(orientation[1] == 1.f) { return 2; }
+	if(orientation[1] == -1.f) { return 3; }
+	if(orientation[2] == 1.f) { return 4; }
+	return 5;
+}
+
+void addFaces(VoxelMap &map, const std::vector<std::pair<unsigned int, glm::vec3>> &faces, const unsigned int chunk, Gg::Component::Mesh &mesh) {
+
+	const std::array<unsigned int, 3> &origin{map.getChunk(chunk).origin};
+	const glm::vec3 chunkOrigin{origin[0], origin[1], origin[2]};
+	const unsigned int firstFace = mesh.m_vertexPosition.size()/4;
+	VoxelFaceIndex &faceIndex{map.getChunkFaces(chunk)};
+
+	mesh.m_vertexPosition.resize(mesh.m_vertexPosition.size() + faces.size()*4);
+	mesh.m_vertexNormal.resize(mesh.m_vertexNormal.size() + faces.size()*4);
+	mesh.m_vertexColor.resize(mesh.m_vertexColor.size() + faces.size()*4);
+	mesh.m_vertexIndice.resize(mesh.m_vertexIndice.size() + faces.size()*6);
+
+	for(unsigned int face{0}; face < faces.size(); face++) {
+
+		const unsigned int i{face + firstFace};
+		faceIndex.insert(map.getLocalVoxel(faces[face].first), getDirectionIndex(faces[face].second), i);
+
+		const std::array<unsigned int, 4> points{getPointsOfOrientedFace(faces[face].second)};
+
+		for(unsigned int k{0}; k < 4; k++) {
+
+			mesh.m_vertexPosition[i*4 + k] = getPositionOfPoint(map, faces[face].first, points[k]) - chunkOrigin;
+			mesh.m_vertexColor[i*4 + k] = map.getColor(faces[face].first);
+		}
+
+		const glm::vec3 normal{glm::triangleNormal(mesh.m_vertexPosition[i*4], mesh.m_vertexPosition[i*4 + 1], mesh.m_vertexPosition[i*4 + 2])};
+		for(unsigned int k{0}; k < 4; k++) { mesh.m_vertexNormal[i*4 + k] = normal; }
+
+		mesh.m_vertexIndice[i*6] = i*4;
+		mesh.m_vertexIndice[i*6 + 1] = i*4 + 1;
+		mesh.m_vertexIndice[i*6 + 2] = i*4 + 2;
+		mesh.m_vertexIndice[i*6 + 3] = i*4;
+		mesh.m_vertexIndice[i*6 + 4] = i*4 + 2;
+		mesh.m_vertexIndice[i*6 + 5] = i*4 + 3;
+	}
+}
+
+void worldMapToMesh(VoxelMap &map, const unsigned int chunk, Gg::Component::Mesh &mesh) {
+
+	mesh.m_vertexPosition.clear();
+	mesh.m_vertexColor.clear();
+	mesh.m_vertexNormal.clear();
+	mesh.m_vertexIndice.clear();
+
+	std::vector<unsigned int> voxels{map.getVoxelsOfChunk(chunk)};
+	map.getChunkFaces(chunk).clear();
+
+	std::vector<std::pair<unsigned int, glm::vec3>> allFaces{voxelsAndOrientations(voxels)};
+	allFaces = selectVisibleFaces(map, allFaces);
+
+	addFaces(map, allFaces, chunk, mesh);
+}
+
+}
+
+void fillMap(VoxelMap &map) {
+
+	const std::array<unsigned int, 3> size{map.getWorldDimensions()};
+
+	for(unsigned int x{0}; x < size[0]; x++) {
+		for(unsigned int y{0}; y < size[1]; y++) {
+
+			const unsigned int height{(x*7 + y*3) % size[2]};
+
+			for(unsigned int z{0}; z <= height; z++) {
+
+				map.setColor(x, y, z, z == height ? glm::vec4{0.24f, 0.56f, 0.1f, 1.f} : glm::vec4{0.56f, 0.24f, 0.05f*(z % 3), 1.f});
+			}
+		}
+	}
+}
+
+template<typename MeshType>
+using MeshingFunction = void (*)(VoxelMap &, const unsigned int, MeshType &);
+
+template<typename MeshType>
+std::vector<MeshType> meshMap(VoxelMap &map, MeshingFunction<MeshType> meshing) {
+
+	std::vector<MeshType> meshes(map.getNbChunks(), MeshType{0});
+	for(unsigned int chunk{0}; chunk < map.getNbChunks(); chunk++) { meshing(map, chunk, meshes[chunk]); }
+
+	return meshes;
+}
+
+// The packed corners are in voxels, the previous positions were at +-0.5 from the voxel centers
+
+bool sameFaces(const std::vector<Gg::Component::Mesh> &previous, const std::vector<Gg::Component::VoxelMesh> &packed) {
+
+	for(size_t i{0}; i < previous.size(); i++) {
+
+		if(previous[i].m_vertexPosition.size() != packed[i].getNbVertices() || previous[i].m_vertexIndice.size() != packed[i].getNbIndices()) { return false; }
+
+		for(size_t j{0}; j < packed[i].getNbVertices(); j++) {
+
+			const std::uint32_t position{packed[i].m_vertices[j].position};
+			const glm::vec3 corner{position & 63u, position >> 6 & 63u, position >> 12 & 63u};
+
+			if(corner - 0.5f != previous[i].m_vertexPosition[j]
+			|| Gg::Component::VoxelMesh::packColor(previous[i].m_vertexColor[j]) != packed[i].m_vertices[j].color) { return false; }
+		}
+
+		for(size_t j{0}; j < packed[i].getNbIndices(); j++) {
+
+			const std::uint32_t index{packed[i].m_useLongIndices ? packed[i].m_longIndices[j] : packed[i].m_shortIndices[j]};
+			if(index != previous[i].m_vertexIndice[j]) { return false; }
+		}
+	}
+
+	return true;
+}
+
+double getPeakRSS() {
+
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	return usage.ru_maxrss/1024.0;
+}
+
+// Runs in a child process, which starts from the small RSS of the parent
+
+template<typename MeshType>
+bool measurePath(const std::string &name, MeshingFunction<MeshType> meshing) {
+
+	std::cout.flush();
+
+	const pid_t child{fork()};
+	if(child < 0) { return false; }
+
+	if(child == 0) {
+
+		VoxelMap map{200, 600, 40};
+		fillMap(map);
+
+		const double mapRSS{getPeakRSS()};
+
+		std::chrono::time_point<std::chrono::steady_clock> start{std::chrono::steady_clock::now()};
+		std::vector<MeshType> meshes{meshMap(map, meshing)};
+		const double time{std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()};
+
+		std::cout << "    " << name << ": " << time << " ms, peak RSS " << getPeakRSS() << " MB (" << mapRSS << " MB before meshing)" << std::endl;
+		_exit(0);
+	}
+
+	int status{0};
+	waitpid(child, &status, 0);
+
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+int main() {
+
+	std::cout << "200x600x40 map, full meshing of every chunk" << std::endl;
+
+	bool succeeded{measurePath("previous path", &Previous::worldMapToMesh)};
+	succeeded = measurePath("streaming", &worldMapToMesh) && succeeded;
+
+	VoxelMap previousMap{200, 600, 40}, map{200, 600, 40};
+	fillMap(previousMap);
+	fillMap(map);
+
+	const bool same{sameFaces(meshMap(previousMap, &Previous::worldMapToMesh), meshMap(map, &worldMapToMesh))};
+	std::cout << "    " << (same ? "same faces" : "RESULT MISMATCH") << std::endl;
+
+	return succeeded && same ? 0 : 1;
+}
@@ -27,9 +27,16 @@ struct Light {
     uint lightType;
 };
 
-layout(location = 0) in vec3 vertex;
-layout(location = 1) in vec3 normal;
-layout(location = 2) in vec3 color;
+// Packed voxel vertex, see VoxelMesh.hpp
+
+layout(location = 0) in uint packedPosition;
+layout(location = 1) in uint packedColor;
+
+// Normals of the face directions +x, -x, +y, -y, +z, -z, as they used to be computed from the corners
+
+const vec3 Normals[6] = vec3[6](vec3(1.0, 0.0, 0.0), vec3(-1.0, 0.0, 0.0),
+                                vec3(0.0, 1.0, 0.0), vec3(0.0, -1.0, 0.0),
+                                vec3(0.0, 0.0, -1.0), vec3(0.0, 0.0, -1.0));
 
 uniform mat4 ModelMatrix;
 uniform mat4 ViewMatrix;
@@ -44,6 +51,10 @@ out vec3 toFragColor;
 
 void main() {
 
+   vec3 vertex = vec3(float(packedPosition & 63u), float((packedPosition >> 6u) & 63u), float((packedPosition >> 12u) & 63u)) - 0.5;
+   vec3 normal = Normals[int((packedPosition >> 18u) & 7u)];
+   vec3 color = vec3(float(packedColor & 255u), float((packedColor >> 8u) & 255u), float((packedColor >> 16u) & 255u))/255.0;
+
    gl_Position = ProjectionMatrix*ViewMatrix*ModelMatrix*vec4(vertex, 1.0);
 
    toFragPosition = vec3(ModelMatrix*vec4(vertex, 1.0));
@@ -6,6 +6,7 @@
 
 #include "GulgEngine/GulgEngine.hpp"
 #include "GulgEngine/GulgDeclarations.hpp"
+#include "GulgEngine/EntityQuery.hpp"
 
 namespace Gg {
 
@@ -21,16 +22,77 @@ class AbstractAlgorithm {
 		void addEntity(const Entity newEntity);
 		void deleteEntity(const Entity entity);
 
-		Signature getSignature() const;
+		void subscribe();
+		bool isSubscribed() const;
+		bool wantsSubscription() const;
+
+		const Signature &getSignature() const;
+		const EntityQuery &getEntities() const;
+
+		const Signature &getReadSignature() const;
+		const Signature &getWriteSignature() const;
+		bool isMainThreadOnly() const;
+
+		// True when both algorithms can't run at the same time: one writes a component
+		// the other reads or writes. An algorithm declaring nothing conflicts with everything.
+		bool conflictsWith(const AbstractAlgorithm &other) const;
 
 		virtual void apply() = 0;
 
 	protected:
 
 		GulgEngine &m_gulgEngine;
-		std::vector<Entity> m_entitiesToApply;
+		EntityQuery m_entitiesToApply;
 
 		Signature m_signature;
+
+		// When true, the System subscribes the algorithm to the engine, which then keeps
+		// m_entitiesToApply filled with every entity matching m_signature.
+		// Otherwise entities are only given through addEntity().
+
+		bool m_subscribeToEngine;
+
+		// Calls function on every element of entities (an EntityQuery or any indexable container),
+		// chunkSize elements per job. Elements must be processed independently.
+
+		template<typename Container, typename Function>
+		void parallelFor(const Container &entities, const size_t chunkSize, Function function) {
+
+			m_gulgEngine.getJobSystem().parallelFor(entities.size(), chunkSize, [&entities, &function](const size_t begin, const size_t end) {
+
+				for(size_t i{begin}; i < end; i++) { function(entities[i]); }
+			});
+		}
+
+		// Same for the entities of a view, given as View::each gives them. Jobs take chunkSize slots
+		// of the dense arrays of the driving pool each.
+
+		template<typename... Ts, typename Function>
+		void parallelEach(const View<Ts...> &view, const size_t chunkSize, Function function) {
+
+			m_gulgEngine.getJobSystem().parallelFor(view.getNbSlots(), chunkSize, [&view, &function](const size_t begin, const size_t end) {
+
+				view.each(begin, end, function);
+			});
+		}
+
+		// Components accessed by apply(), used by Systems::Scheduler to run algorithms concurrently.
+		// Algorithms using OpenGL must set m_mainThreadOnly.
+
+		template<typename... Ts>
+		void reads() { ((m_readSignature += m_gulgEngine.getComponentSignature<Ts>()), ...); }
+
+		template<typename... Ts>
+		void writes() { ((m_writeSignature += m_gulgEngine.getComponentSignature<Ts>()), ...); }
+
+		Signature m_readSignature, m_writeSignature;
+		bool m_mainThreadOnly;
+
+	private:
+
+		bool declaresAccess() const;
+
+		bool m_isSubscribed;
 };
 
 }}
@@ -11,6 +11,7 @@
 #include "Algorithms/SpecializedAlgorithm.hpp"
 
 #include "Components/Mesh.hpp"
+#include "Components/LevelOfDetail.hpp"
 #include "Components/SceneObject.hpp"
 
 namespace Gg {
@@ -26,10 +27,14 @@ class DrawMesh: public SpecializedAlgorithm {
 
 		void apply(); 
 
+		// Bytes sent to the GPU by the last apply()
+		size_t getUploadedBytes() const;
+
 	private:
 
 		Gg::Entity &m_cameraEntity;
 		glm::mat4 &m_projectionMatrix;
+		size_t m_uploadedBytes;
 };
 
 }}
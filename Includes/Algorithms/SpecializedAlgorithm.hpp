@@ -19,6 +19,7 @@ class SpecializedAlgorithm: public AbstractAlgorithm {
 	protected:
 
 		const std::string m_componentToApply;
+		const ComponentID m_componentIDToApply;
 };
 
 }}
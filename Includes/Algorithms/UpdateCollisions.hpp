@@ -5,6 +5,7 @@
 #include "Systems/Collisions.hpp"
 
 #include "Components/SceneObject.hpp"
+#include "Components/Transformation.hpp"
 #include "Components/Collider.hpp"
 #include "Components/Forces.hpp"
 #include "Components/VoxelMap.hpp"
@@ -0,0 +1,49 @@
+#ifndef UPDATE_LEVEL_OF_DETAIL_ALGORITHM_HPP
+#define UPDATE_LEVEL_OF_DETAIL_ALGORITHM_HPP
+
+#include <array>
+
+#include "Algorithms/Algorithm.hpp"
+
+#include "Components/LevelOfDetail.hpp"
+#include "Components/SceneObject.hpp"
+#include "Components/VoxelMap.hpp"
+
+#include "NewMap.hpp"
+
+// Chunks drawn at each level by the last update, and their triangles
+struct LevelOfDetailStatistics {
+
+	std::array<unsigned int, Gg::Component::LevelOfDetail::NbLevels> nbChunks;
+	size_t nbTriangles, nbFullDetailTriangles;
+	unsigned int nbBuiltMeshes;
+};
+
+namespace Gg {
+
+namespace Algorithm {
+
+// Picks the level of detail of the chunks of the voxel maps from their distance to the camera.
+// The coarse mesh of a level is only built when a chunk switches to it after its last meshing,
+// the chunks needing one being built concurrently.
+
+class UpdateLevelOfDetail: public AbstractAlgorithm {
+
+	public:
+
+		UpdateLevelOfDetail(Gg::Entity &cameraEntity, GulgEngine &gulgEngine);
+		virtual ~UpdateLevelOfDetail();
+
+		void apply();
+
+		const LevelOfDetailStatistics &getStatistics() const;
+
+	private:
+
+		Gg::Entity &m_cameraEntity;
+		LevelOfDetailStatistics m_statistics;
+};
+
+}}
+
+#endif
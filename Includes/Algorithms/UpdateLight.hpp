@@ -29,6 +29,7 @@ class UpdateLight: public SpecializedAlgorithm {
 	private:
 
 		const GLuint m_program;
+		const GLint m_nbLightID;
 		unsigned int m_currentLightNumber;
 };
 
@@ -2,6 +2,7 @@
 #define UPDATE_TRANSFORMATION_ALGORITHM_HPP
 
 #include <string>
+#include <vector>
 
 #include <glm/vec3.hpp>
 #include <glm/ext/matrix_transform.hpp>
@@ -26,9 +27,20 @@ class UpdateTransformations: public AbstractAlgorithm {
 
 		void apply(); 
 
+		// Number of global matrices recomputed by the last apply()
+		size_t getNbUpdatedNodes() const;
+
 	private:
 
-		void applyTransformations(const Gg::Entity entity, const glm::mat4 transformation = glm::mat4{1.0});
+		// Indexed by entity index
+		std::vector<glm::mat4> m_globalTransformations;
+		std::vector<bool> m_hasMoved;
+
+		// Indexed by position in the scene graph order
+		std::vector<bool> m_hasChanged;
+
+		bool m_sceneIsKnown;
+		size_t m_nbUpdatedNodes;
 };
 
 }}
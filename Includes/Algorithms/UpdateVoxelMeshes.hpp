@@ -0,0 +1,35 @@
+#ifndef UPDATE_VOXEL_MESHES_ALGORITHM_HPP
+#define UPDATE_VOXEL_MESHES_ALGORITHM_HPP
+
+#include "Algorithms/Algorithm.hpp"
+
+#include "Components/Mesh.hpp"
+#include "Components/VoxelMap.hpp"
+
+#include "NewMap.hpp"
+
+namespace Gg {
+
+namespace Algorithm {
+
+class UpdateVoxelMeshes: public AbstractAlgorithm {
+
+	public:
+
+		UpdateVoxelMeshes(GulgEngine &gulgEngine);
+		virtual ~UpdateVoxelMeshes();
+
+		void apply();
+
+		// Number of chunks remeshed by the last apply()
+		unsigned int getNbRemeshedChunks() const;
+		const VoxelMeshStatistics &getStatistics() const;
+
+	private:
+
+		VoxelMeshStatistics m_statistics;
+};
+
+}}
+
+#endif
@@ -52,54 +52,75 @@ struct AnimatedMesh: public Mesh {
 
 	AnimatedMesh(GLuint program, GLuint texture):
 		Mesh{program},
-		m_bonesTransformationsID{glGetUniformLocation(m_program, "BonesTransformations")},
-		m_textureID{texture} {
-
-			glGenVertexArrays(1, &m_vertexArrayID);
-			glGenBuffers(1, &m_vertexPositionID);
-			glGenBuffers(1, &m_vertexNormalID);
-			glGenBuffers(1, &m_vertexIndiceID);
-			glGenBuffers(1, &m_vertexColorID);
-			glGenBuffers(1, &m_vertexBonesID);
-			glGenBuffers(1, &m_vertexWeightID);
-		}
+		m_bonesTransformationsID{-1},
+		m_textureID{texture},
+		m_vertexBonesID{0},
+		m_vertexWeightID{0} {}
 
 	AnimatedMesh(const AnimatedMesh &mesh):
-		Mesh{mesh.m_program},
+		Mesh{mesh},
+		m_bonesTransformationsID{-1},
 		m_textureID{mesh.m_textureID},
+		m_vertexBonesID{0},
+		m_vertexWeightID{0},
 		m_vertexBones{mesh.m_vertexBones},
-		m_vertexWeight{mesh.m_vertexWeight} {
+		m_vertexWeight{mesh.m_vertexWeight},
+		m_bones{mesh.m_bones} {}
 
-		glGenBuffers(1, &m_vertexBonesID);
-		glGenBuffers(1, &m_vertexWeightID);
+	~AnimatedMesh() {
 
-		m_vertexPosition = mesh.m_vertexPosition;
-		m_vertexNormal = mesh.m_vertexNormal;
-		m_vertexColor = mesh.m_vertexColor;
-		m_vertexIndice = mesh.m_vertexIndice;
+		if(m_vertexArrayID != 0) {
 
-		reshape();
+			glDeleteBuffers(1, &m_vertexWeightID);
+			glDeleteBuffers(1, &m_vertexBonesID);
+		}
 	}
 
-	~AnimatedMesh() {
 
-		glDeleteBuffers(1, &m_vertexWeightID);
-		glDeleteBuffers(1, &m_vertexBonesID);
-		glDeleteBuffers(1, &m_vertexColorID);
-		glDeleteBuffers(1, &m_vertexIndiceID);
-		glDeleteBuffers(1, &m_vertexNormalID);
-		glDeleteBuffers(1, &m_vertexPositionID);
-		glDeleteVertexArrays(1, &m_vertexArrayID);
+	virtual std::shared_ptr<AbstractComponent> clone() const { 
+
+		return std::static_pointer_cast<AbstractComponent>(makeComponent<AnimatedMesh>(*this)); 
 	}
 
+	virtual size_t draw(const glm::mat4 &modelMatrix, const glm::mat4 &viewMatrix, const glm::mat4 &projectionMatrix) {
 
-	virtual std::shared_ptr<AbstractComponent> clone() const { 
+		std::vector<glm::mat4> bonesTransfo;
+		unsigned int nbBones{m_bones.bonesNumber()};
+		bonesTransfo.resize(nbBones);
+		m_bones.giveTransformations(bonesTransfo);
+
+		const size_t uploadedBytes{prepare()};
+		
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, m_textureID);
+
+		glBindVertexArray(m_vertexArrayID);
+		glUseProgram(m_program);
+
+	    glUniformMatrix4fv(m_modelMatrixID, 1, GL_FALSE, &modelMatrix[0][0]);
+	    glUniformMatrix4fv(m_viewMatrixID, 1, GL_FALSE, &viewMatrix[0][0]);
+	    glUniformMatrix4fv(m_projectionMatrixID, 1, GL_FALSE, &projectionMatrix[0][0]);
+	    glUniformMatrix4fv(m_bonesTransformationsID, nbBones, GL_FALSE, &bonesTransfo[0][0][0]);
+
+	    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndiceID);
+	    glDrawElements(GL_TRIANGLES, m_vertexIndice.size(), GL_UNSIGNED_INT, reinterpret_cast<void*>(0));
 
-		return std::static_pointer_cast<AbstractComponent>(std::make_shared<AnimatedMesh>(*this)); 
+	    return uploadedBytes;
 	}
 
+	protected:
 
-	virtual void reshape() {
+	virtual void createBuffers() {
+
+		Mesh::createBuffers();
+
+		m_bonesTransformationsID = glGetUniformLocation(m_program, "BonesTransformations");
+
+		glGenBuffers(1, &m_vertexBonesID);
+		glGenBuffers(1, &m_vertexWeightID);
+	}
+
+	virtual size_t upload() {
 
 		glBindVertexArray(m_vertexArrayID);
 
@@ -130,30 +151,13 @@ struct AnimatedMesh: public Mesh {
 
 	    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndiceID);
 	    glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndice.size() * sizeof(unsigned int), &m_vertexIndice[0], GL_DYNAMIC_DRAW);
-	}
-
-	virtual void draw(const glm::mat4 &modelMatrix, const glm::mat4 &viewMatrix, const glm::mat4 &projectionMatrix) {
-
-		std::vector<glm::mat4> bonesTransfo;
-		unsigned int nbBones{m_bones.bonesNumber()};
-		bonesTransfo.resize(nbBones);
-		m_bones.giveTransformations(bonesTransfo);
-		
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, m_textureID);
-
-		glBindVertexArray(m_vertexArrayID);
-		glUseProgram(m_program);
-
-	    glUniformMatrix4fv(m_modelMatrixID, 1, GL_FALSE, &modelMatrix[0][0]);
-	    glUniformMatrix4fv(m_viewMatrixID, 1, GL_FALSE, &viewMatrix[0][0]);
-	    glUniformMatrix4fv(m_projectionMatrixID, 1, GL_FALSE, &projectionMatrix[0][0]);
-	    glUniformMatrix4fv(m_bonesTransformationsID, nbBones, GL_FALSE, &bonesTransfo[0][0][0]);
 
-	    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndiceID);
-	    glDrawElements(GL_TRIANGLES, m_vertexIndice.size(), GL_UNSIGNED_INT, reinterpret_cast<void*>(0));
+	    return (m_vertexPosition.size() + m_vertexNormal.size() + m_vertexColor.size() + m_vertexWeight.size())*sizeof(glm::vec3)
+	         + m_vertexBones.size()*sizeof(glm::ivec3) + m_vertexIndice.size()*sizeof(unsigned int);
 	}
 
+	public:
+
 	GLint m_bonesTransformationsID;
 
 	GLuint m_textureID, m_vertexBonesID, m_vertexWeightID;
@@ -17,7 +17,7 @@ struct Boolean: public AbstractComponent {
 
 	Boolean(const bool val): value{val} {}
 
-	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(std::make_shared<Boolean>(*this)); }
+	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(makeComponent<Boolean>(*this)); }
 
 	bool value;          
 };
@@ -28,7 +28,7 @@ struct UnsignedInt: public AbstractComponent {
 
 	UnsignedInt(const unsigned int val): value{val} {}
 
-	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(std::make_shared<UnsignedInt>(*this)); }
+	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(makeComponent<UnsignedInt>(*this)); }
 
 	unsigned int value;          
 };
@@ -39,7 +39,7 @@ struct EntityComponent: public AbstractComponent {
 
 	EntityComponent(const Entity val): value{val} {}
 
-	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(std::make_shared<EntityComponent>(*this)); }
+	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(makeComponent<EntityComponent>(*this)); }
 
 	Entity value;          
 };
@@ -50,7 +50,7 @@ struct String: public AbstractComponent {
 
 	String(const std::string val): value{val} {}
 
-	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(std::make_shared<String>(*this)); }
+	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(makeComponent<String>(*this)); }
 
 	std::string value;          
 };
@@ -61,7 +61,7 @@ struct Vector2D: public AbstractComponent {
 	Vector2D(const float x, const float y): value{x, y} {}
 	Vector2D(const Vector2D &vec): value{vec.value} {}
 
-	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(std::make_shared<Vector2D>(*this)); }
+	virtual std::shared_ptr<AbstractComponent> clone() const { return std::static_pointer_cast<AbstractComponent>(makeComponent<Vector2D>(*this)); }
 
 	float norm() { return sqrt(value.x*value.x + value.y*value.y); }
 	sf::Vector2f value;          
@@ -20,7 +20,7 @@ namespace Gg {
 
       virtual std::shared_ptr<AbstractComponent> clone() const{
 
-        return std::static_pointer_cast<Gg::Component::AbstractComponent>(std::make_shared<Collider>(*this));
+        return std::static_pointer_cast<Gg::Component::AbstractComponent>(makeComponent<Collider>(*this));
       }
 
 
@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "GulgEngine/GulgDeclarations.hpp"
+#include "GulgEngine/ComponentAllocator.hpp"
 
 namespace Gg {
 
@@ -0,0 +1,70 @@
+#ifndef COMPONENT_TYPES_HPP
+#define COMPONENT_TYPES_HPP
+
+#include <array>
+
+#include "GulgEngine/GulgDeclarations.hpp"
+
+class VoxelMap;
+
+namespace Gg {
+
+namespace Component {
+
+class Collider;
+class Explosive;
+class Forces;
+struct LevelOfDetail;
+struct Light;
+struct Mesh;
+struct SceneObject;
+class StepSound;
+class Timer;
+struct Transformation;
+
+// Compile time ids of the components. An id is also the bit of the component in signatures,
+// so ComponentNames must list the names of Datas/Signatures in the order the SignatureLoader
+// numbers them (alphabetical). GulgEngine::loadSignatures checks that both agree.
+
+constexpr std::array<const char*, 12> ComponentNames{
+
+	"Collider",
+	"Explosive",
+	"Forces",
+	"LevelOfDetail",
+	"Light",
+	"MainMesh",
+	"SceneObject",
+	"StepSound",
+	"Timer",
+	"Transformations",
+	"VoxelMap",
+	"WorldCollider"
+};
+
+template<typename T>
+struct ComponentType;
+
+#define GULG_COMPONENT_TYPE(Type, ID) \
+	template<> struct ComponentType<Type> { \
+		static constexpr ComponentID id{ID}; \
+		static constexpr const char *name{ComponentNames[ID]}; \
+	};
+
+GULG_COMPONENT_TYPE(Collider, 0)
+GULG_COMPONENT_TYPE(Explosive, 1)
+GULG_COMPONENT_TYPE(Forces, 2)
+GULG_COMPONENT_TYPE(LevelOfDetail, 3)
+GULG_COMPONENT_TYPE(Light, 4)
+GULG_COMPONENT_TYPE(Mesh, 5)
+GULG_COMPONENT_TYPE(SceneObject, 6)
+GULG_COMPONENT_TYPE(StepSound, 7)
+GULG_COMPONENT_TYPE(Timer, 8)
+GULG_COMPONENT_TYPE(Transformation, 9)
+GULG_COMPONENT_TYPE(::VoxelMap, 10)
+
+#undef GULG_COMPONENT_TYPE
+
+}}
+
+#endif
@@ -23,7 +23,7 @@ namespace Gg {
 
       virtual std::shared_ptr<AbstractComponent> clone() const{
 
-        return std::static_pointer_cast<Gg::Component::AbstractComponent>(std::make_shared<Explosive>(*this));
+        return std::static_pointer_cast<Gg::Component::AbstractComponent>(makeComponent<Explosive>(*this));
       }
       int explosivePower;
       explosiveTrigger eTrigger;
@@ -22,7 +22,7 @@ namespace Gg {
 
       virtual std::shared_ptr<AbstractComponent> clone() const{
 
-        return std::static_pointer_cast<Gg::Component::AbstractComponent>(std::make_shared<Forces>(*this));
+        return std::static_pointer_cast<Gg::Component::AbstractComponent>(makeComponent<Forces>(*this));
       }
 
       //Acceleration = Forces / Mass
@@ -0,0 +1,92 @@
+#ifndef LEVEL_OF_DETAIL_COMPONENTS_HPP
+#define LEVEL_OF_DETAIL_COMPONENTS_HPP
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <stdexcept>
+
+#include "Components/VoxelMesh.hpp"
+
+namespace Gg {
+
+namespace Component {
+
+// Coarser meshes of a voxel chunk entity, drawn instead of its MainMesh when the camera is far.
+// Level l merges 2^l voxels along each axis into one, level 0 being the MainMesh itself.
+// The level goes up once the distance is over the distance of the next level by Hysteresis,
+// and down once it is under the distance of the current level by Hysteresis, so a camera
+// staying around a distance doesn't switch meshes every frame.
+
+struct LevelOfDetail: public AbstractComponent {
+
+	static constexpr unsigned int NbLevels{4};
+	static constexpr float Hysteresis{0.1f};
+	static constexpr unsigned int NoVersion{std::numeric_limits<unsigned int>::max()};
+
+	LevelOfDetail(GLuint program, const std::array<float, NbLevels> &distances = std::array<float, NbLevels>{0.f, 128.f, 256.f, 512.f}):
+		m_distances{distances},
+		m_level{0},
+		m_meshes(NbLevels - 1, VoxelMesh{program}),
+		m_meshVersions(NbLevels - 1, NoVersion) {}
+
+	LevelOfDetail(const LevelOfDetail &levelOfDetail):
+		m_distances{levelOfDetail.m_distances},
+		m_level{levelOfDetail.m_level},
+		m_meshes{levelOfDetail.m_meshes},
+		m_meshVersions{levelOfDetail.m_meshVersions} {}
+
+	virtual std::shared_ptr<AbstractComponent> clone() const {
+
+		return std::static_pointer_cast<AbstractComponent>(Gg::makeComponent<LevelOfDetail>(*this));
+	}
+
+	// Returns true when the level changed
+	bool selectLevel(const float distance) {
+
+		const unsigned int previousLevel{m_level};
+
+		while(m_level + 1 < NbLevels && distance > m_distances[m_level + 1]*(1.f + Hysteresis)) { m_level++; }
+		while(m_level > 0 && distance < m_distances[m_level]*(1.f - Hysteresis)) { m_level--; }
+
+		return m_level != previousLevel;
+	}
+
+	unsigned int getLevel() const { return m_level; }
+
+	VoxelMesh &getMesh(const unsigned int level) {
+
+		checkLevel(level);
+		return m_meshes[level - 1];
+	}
+
+	// Versions are the VoxelChunk::meshVersion the mesh was built from
+	bool isOutdated(const unsigned int level, const unsigned int version) const {
+
+		checkLevel(level);
+		return m_meshVersions[level - 1] != version;
+	}
+
+	void setMeshVersion(const unsigned int level, const unsigned int version) {
+
+		checkLevel(level);
+		m_meshVersions[level - 1] = version;
+	}
+
+	private:
+
+		void checkLevel(const unsigned int level) const {
+
+			if(level == 0 || level >= NbLevels) { throw std::runtime_error("Gulg error: level of detail " + std::to_string(level) + " has no mesh of its own."); }
+		}
+
+		std::array<float, NbLevels> m_distances;
+		unsigned int m_level;
+
+		std::vector<VoxelMesh> m_meshes;
+		std::vector<unsigned int> m_meshVersions;
+};
+
+}}
+
+#endif
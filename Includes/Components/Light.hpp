@@ -32,7 +32,7 @@ struct Light: public AbstractComponent {
 
 	virtual std::shared_ptr<AbstractComponent> clone() const { 
 
-		return std::static_pointer_cast<AbstractComponent>(std::make_shared<Light>(*this)); 
+		return std::static_pointer_cast<AbstractComponent>(makeComponent<Light>(*this)); 
 	}
 
     //Directional light
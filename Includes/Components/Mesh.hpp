@@ -2,6 +2,7 @@
 #define MESH_COMPONENTS_HPP
 
 #include <string>
+#include <vector>
 
 #include <GL/glew.h>
 #include <GL/gl.h>
@@ -17,97 +18,144 @@ namespace Component {
 
 struct Mesh: public AbstractComponent {
 
+	// No OpenGL call is made before the first draw, so meshes can be built and modified
+	// outside of the thread owning the context. reshape() only asks for a new upload.
+	// draw() and prepare() return the number of bytes sent to the GPU.
+
 	Mesh(GLuint program):
 
 		m_program{program},
-		m_modelMatrixID{glGetUniformLocation(m_program, "ModelMatrix")},
-		m_viewMatrixID{glGetUniformLocation(m_program, "ViewMatrix")},
-		m_projectionMatrixID{glGetUniformLocation(m_program, "ProjectionMatrix")} {
-
-			glGenVertexArrays(1, &m_vertexArrayID);
-			glGenBuffers(1, &m_vertexPositionID);
-			glGenBuffers(1, &m_vertexNormalID);
-			glGenBuffers(1, &m_vertexIndiceID);
-			glGenBuffers(1, &m_vertexColorID);
-		}
+		m_vertexArrayID{0},
+		m_vertexIndiceID{0},
+		m_vertexPositionID{0},
+		m_vertexNormalID{0},
+		m_vertexColorID{0},
+		m_modelMatrixID{-1},
+		m_viewMatrixID{-1},
+		m_projectionMatrixID{-1},
+		m_needUpload{true} {}
 
 	Mesh(const Mesh &mesh):
 		m_program{mesh.m_program},
-		m_modelMatrixID{mesh.m_modelMatrixID},
-		m_viewMatrixID{mesh.m_viewMatrixID},
-		m_projectionMatrixID{mesh.m_projectionMatrixID},
+		m_vertexArrayID{0},
+		m_vertexIndiceID{0},
+		m_vertexPositionID{0},
+		m_vertexNormalID{0},
+		m_vertexColorID{0},
+		m_modelMatrixID{-1},
+		m_viewMatrixID{-1},
+		m_projectionMatrixID{-1},
 		m_vertexPosition{mesh.m_vertexPosition},
 		m_vertexNormal{mesh.m_vertexNormal},
 		m_vertexColor{mesh.m_vertexColor},
-		m_vertexIndice{mesh.m_vertexIndice} {
+		m_vertexIndice{mesh.m_vertexIndice},
+		m_needUpload{true} {}
 
+	virtual ~Mesh() {
 
-		glGenVertexArrays(1, &m_vertexArrayID);
-		glGenBuffers(1, &m_vertexPositionID);
-		glGenBuffers(1, &m_vertexNormalID);
-		glGenBuffers(1, &m_vertexIndiceID);
-		glGenBuffers(1, &m_vertexColorID);
+		if(m_vertexArrayID != 0) {
 
-		reshape();
+			glDeleteBuffers(1, &m_vertexColorID);
+			glDeleteBuffers(1, &m_vertexIndiceID);
+			glDeleteBuffers(1, &m_vertexNormalID);
+			glDeleteBuffers(1, &m_vertexPositionID);
+			glDeleteVertexArrays(1, &m_vertexArrayID);
+		}
 	}
 
-	~Mesh() {
 
-		glDeleteBuffers(1, &m_vertexColorID);
-		glDeleteBuffers(1, &m_vertexIndiceID);
-		glDeleteBuffers(1, &m_vertexNormalID);
-		glDeleteBuffers(1, &m_vertexPositionID);
-		glDeleteVertexArrays(1, &m_vertexArrayID);
+	virtual std::shared_ptr<AbstractComponent> clone() const { 
+
+		return std::static_pointer_cast<AbstractComponent>(makeComponent<Mesh>(*this)); 
 	}
 
 
-	virtual std::shared_ptr<AbstractComponent> clone() const { 
+	void reshape() { m_needUpload = true; }
+
+	size_t draw(const glm::mat4 &modelMatrix, const glm::mat4 &viewMatrix, const glm::mat4 &projectionMatrix) {
+
+		if(isEmpty()) { return 0; }
+
+		const size_t uploadedBytes{prepare()};
+
+		glBindVertexArray(m_vertexArrayID);
+		glUseProgram(m_program);
+
+	    glUniformMatrix4fv(m_modelMatrixID, 1, GL_FALSE, &modelMatrix[0][0]);
+	    glUniformMatrix4fv(m_viewMatrixID, 1, GL_FALSE, &viewMatrix[0][0]);
+	    glUniformMatrix4fv(m_projectionMatrixID, 1, GL_FALSE, &projectionMatrix[0][0]);
+
+	    drawElements();
+
+	    return uploadedBytes;
+	}
+
+	size_t prepare() {
+
+		if(m_vertexArrayID == 0) { createBuffers(); }
+		if(!m_needUpload) { return 0; }
+
+		m_needUpload = false;
+		return upload();
+	}
+
+	protected:
+
+	virtual bool isEmpty() const { return m_vertexIndice.empty(); }
+
+	virtual void drawElements() {
 
-		return std::static_pointer_cast<AbstractComponent>(std::make_shared<Mesh>(*this)); 
+	    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndiceID);
+	    glDrawElements(GL_TRIANGLES, m_vertexIndice.size(), GL_UNSIGNED_INT, reinterpret_cast<void*>(0));
 	}
 
+	virtual void createBuffers() {
+
+		m_modelMatrixID = glGetUniformLocation(m_program, "ModelMatrix");
+		m_viewMatrixID = glGetUniformLocation(m_program, "ViewMatrix");
+		m_projectionMatrixID = glGetUniformLocation(m_program, "ProjectionMatrix");
+
+		glGenVertexArrays(1, &m_vertexArrayID);
+		glGenBuffers(1, &m_vertexPositionID);
+		glGenBuffers(1, &m_vertexNormalID);
+		glGenBuffers(1, &m_vertexIndiceID);
+		glGenBuffers(1, &m_vertexColorID);
+	}
 
-	void reshape() {
+	virtual size_t upload() {
 
 		glBindVertexArray(m_vertexArrayID);
 
 	    glBindBuffer(GL_ARRAY_BUFFER, m_vertexPositionID);
-	    glBufferData(GL_ARRAY_BUFFER, m_vertexPosition.size()*sizeof(glm::vec3), &m_vertexPosition[0], GL_STATIC_DRAW);
+	    glBufferData(GL_ARRAY_BUFFER, m_vertexPosition.size()*sizeof(glm::vec3), m_vertexPosition.data(), GL_STATIC_DRAW);
 	    glEnableVertexAttribArray(0);
 	    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
 
 	    glBindBuffer(GL_ARRAY_BUFFER, m_vertexNormalID);
-	    glBufferData(GL_ARRAY_BUFFER, m_vertexNormal.size()*sizeof(glm::vec3), &m_vertexNormal[0], GL_STATIC_DRAW);
+	    glBufferData(GL_ARRAY_BUFFER, m_vertexNormal.size()*sizeof(glm::vec3), m_vertexNormal.data(), GL_STATIC_DRAW);
 	    glEnableVertexAttribArray(1);
 	    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
 
 	    glBindBuffer(GL_ARRAY_BUFFER, m_vertexColorID);
-	    glBufferData(GL_ARRAY_BUFFER, m_vertexColor.size()*sizeof(glm::vec3), &m_vertexColor[0], GL_STATIC_DRAW);
+	    glBufferData(GL_ARRAY_BUFFER, m_vertexColor.size()*sizeof(glm::vec3), m_vertexColor.data(), GL_STATIC_DRAW);
 	    glEnableVertexAttribArray(2);
 	    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
 
 	    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndiceID);
-	    glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndice.size() * sizeof(unsigned int), &m_vertexIndice[0], GL_STATIC_DRAW);
-	}
-
-	void draw(const glm::mat4 &modelMatrix, const glm::mat4 &viewMatrix, const glm::mat4 &projectionMatrix) {
+	    glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndice.size() * sizeof(unsigned int), m_vertexIndice.data(), GL_STATIC_DRAW);
 
-		glBindVertexArray(m_vertexArrayID);
-		glUseProgram(m_program);
-
-	    glUniformMatrix4fv(m_modelMatrixID, 1, GL_FALSE, &modelMatrix[0][0]);
-	    glUniformMatrix4fv(m_viewMatrixID, 1, GL_FALSE, &viewMatrix[0][0]);
-	    glUniformMatrix4fv(m_projectionMatrixID, 1, GL_FALSE, &projectionMatrix[0][0]);
-
-	    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndiceID);
-	    glDrawElements(GL_TRIANGLES, m_vertexIndice.size(), GL_UNSIGNED_INT, reinterpret_cast<void*>(0));
+	    return (m_vertexPosition.size() + m_vertexNormal.size() + m_vertexColor.size())*sizeof(glm::vec3) + m_vertexIndice.size()*sizeof(unsigned int);
 	}
 
+	public:
+
 	GLuint m_program, m_vertexArrayID, m_vertexIndiceID, m_vertexPositionID, m_vertexNormalID, m_vertexColorID;
-	const GLint m_modelMatrixID, m_viewMatrixID, m_projectionMatrixID;
+	GLint m_modelMatrixID, m_viewMatrixID, m_projectionMatrixID;
         
     std::vector<glm::vec3> m_vertexPosition, m_vertexNormal, m_vertexColor;
-    std::vector<unsigned int> m_vertexIndice;         
+    std::vector<unsigned int> m_vertexIndice;
+
+    bool m_needUpload;
 };
 
 }}
@@ -19,24 +19,44 @@ namespace Component {
 
 struct SceneObject: public AbstractComponent {
 
-	SceneObject(): m_globalTransformations{1.f} {}
+	SceneObject(): m_globalTransformations{1.f}, m_inverseGlobalTransformations{1.f}, m_inverseIsOutdated{false} {}
 
-	SceneObject(const SceneObject &object): m_globalTransformations{object.m_globalTransformations}  {}
+	SceneObject(const SceneObject &object):
+		m_globalTransformations{object.m_globalTransformations},
+		m_inverseGlobalTransformations{object.m_inverseGlobalTransformations},
+		m_inverseIsOutdated{object.m_inverseIsOutdated} {}
 
 	virtual std::shared_ptr<AbstractComponent> clone() const { 
 
-		return std::static_pointer_cast<AbstractComponent>(std::make_shared<SceneObject>(*this)); 
+		return std::static_pointer_cast<AbstractComponent>(makeComponent<SceneObject>(*this)); 
 	}
 
-	void addChild(Entity newChild) { m_children.emplace_back(newChild); }
-    void deleteChild(Entity child) {
+	// Parent and children are kept by GulgEngine::getSceneGraph()
 
-	   std::vector<Entity>::iterator it = std::find(m_children.begin(), m_children.end(), child);
-	    if(it != m_children.end()) { m_children.erase(it); }
-    }
+	void setGlobalTransformations(const glm::mat4 &transformations) {
+
+		m_globalTransformations = transformations;
+		m_inverseIsOutdated = true;
+	}
+
+	// Only inverted again after the global transformations changed
+	const glm::mat4 &getInverseGlobalTransformations() {
+
+		if(m_inverseIsOutdated) {
+
+			m_inverseGlobalTransformations = glm::inverse(m_globalTransformations);
+			m_inverseIsOutdated = false;
+		}
+
+		return m_inverseGlobalTransformations;
+	}
 
     glm::mat4 m_globalTransformations;
-    std::vector<Entity> m_children;
+
+	private:
+
+		glm::mat4 m_inverseGlobalTransformations;
+		bool m_inverseIsOutdated;
 };
 
 }}
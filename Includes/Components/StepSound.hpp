@@ -20,7 +20,7 @@ namespace Gg {
 
       virtual std::shared_ptr<AbstractComponent> clone() const{
 
-        return std::static_pointer_cast<Gg::Component::AbstractComponent>(std::make_shared<StepSound>(*this));
+        return std::static_pointer_cast<Gg::Component::AbstractComponent>(makeComponent<StepSound>(*this));
       }
 
 
@@ -19,10 +19,14 @@ namespace Gg {
 
       Timer(const Timer &t);
 
+      // Starts the countdown again from now, used by copies of a prefab
+      void restart();
+
       virtual std::shared_ptr<AbstractComponent> clone() const{
 
-        return std::static_pointer_cast<Gg::Component::AbstractComponent>(std::make_shared<Timer>(*this));
+        return std::static_pointer_cast<Gg::Component::AbstractComponent>(makeComponent<Timer>(*this));
       }
+      long duration;
       std::chrono::time_point<std::chrono::system_clock> end;
 
     };
@@ -2,6 +2,7 @@
 #define TRANSFORMATION_COMPONENT_HPP
 
 #include <string>
+#include <memory>
 
 #include <GL/glew.h>
 #include <GL/gl.h>
@@ -19,38 +20,96 @@ namespace Gg {
 
 namespace Component {
 
+// Translation, rotation and scale are kept apart and composed as T*R*S, followed by the
+// specific transformation when one is set. The composed matrix is cached by update().
+
 struct Transformation: public AbstractComponent {
 
 	Transformation():
-	    m_translation{1.f},
-	    m_scale{1.f},
-	    m_specificTransformation{1.f},
-	    m_rotation{glm::vec3{0.f, 0.f, 0.f}} {}
+	    m_translation{0.f, 0.f, 0.f},
+	    m_rotation{glm::vec3{0.f, 0.f, 0.f}},
+	    m_scale{1.f, 1.f, 1.f},
+	    m_matrix{1.f},
+	    m_needUpdate{true} {}
 
 	Transformation(const Transformation &trans):
 	    m_translation{trans.m_translation},
+	    m_rotation{trans.m_rotation},
 	    m_scale{trans.m_scale},
-	    m_specificTransformation{trans.m_specificTransformation},
-	    m_rotation{trans.m_rotation} {}
+	    m_specificTransformation{trans.m_specificTransformation ? std::make_unique<glm::mat4>(*trans.m_specificTransformation) : nullptr},
+	    m_matrix{trans.m_matrix},
+	    m_needUpdate{true} {}
+
+	Transformation &operator=(const Transformation &trans) {
+
+		m_translation = trans.m_translation;
+		m_rotation = trans.m_rotation;
+		m_scale = trans.m_scale;
+		m_specificTransformation = trans.m_specificTransformation ? std::make_unique<glm::mat4>(*trans.m_specificTransformation) : nullptr;
+		m_matrix = trans.m_matrix;
+		m_needUpdate = true;
+
+		return *this;
+	}
 
 	virtual std::shared_ptr<AbstractComponent> clone() const {
 
-		return std::static_pointer_cast<AbstractComponent>(std::make_shared<Transformation>(*this));
+		return std::static_pointer_cast<AbstractComponent>(makeComponent<Transformation>(*this));
 	}
 
-    void translate(const glm::vec3 &translation) { m_translation = glm::translate(m_translation, translation); }
+    void translate(const glm::vec3 &translation) { m_translation += translation; m_needUpdate = true; }
+
+    void rotate(const float angle, const glm::vec3 &axis) { m_rotation = glm::angleAxis(angle, axis)*m_rotation; m_needUpdate = true; }
+
+    void scale(const float scaling) { m_scale *= scaling; m_needUpdate = true; }
+
+    void setSpecificTransformation(const glm::mat4 trans) {
+
+    	if(trans == glm::mat4{1.f}) { m_specificTransformation.reset(); }
+    	else if(m_specificTransformation) { *m_specificTransformation = trans; }
+    	else { m_specificTransformation = std::make_unique<glm::mat4>(trans); }
+
+    	m_needUpdate = true;
+    }
+
+    const glm::vec3 &getTranslation() const { return m_translation; }
+    const glm::quat &getRotation() const { return m_rotation; }
+    const glm::vec3 &getScale() const { return m_scale; }
+
+    // Composed on the fly while the cache is outdated, so reading stays free of side effects
+    glm::mat4 getTransformationMatrix() const { return m_needUpdate ? compose() : m_matrix; }
+
+    bool needUpdate() const { return m_needUpdate; }
+
+    const glm::mat4 &update() {
+
+    	m_matrix = compose();
+    	m_needUpdate = false;
+    	return m_matrix;
+    }
+
+	private:
 
-    void rotate(const float angle, const glm::vec3 &axis) { m_rotation = glm::angleAxis(angle, axis)*m_rotation; }
+		glm::mat4 compose() const {
 
-    void scale(const float scaling) { m_scale = glm::scale(m_scale, glm::vec3{scaling, scaling, scaling}); }
+			glm::mat4 matrix{glm::toMat4(m_rotation)};
 
-    void setSpecificTransformation(const glm::mat4 trans) { m_specificTransformation = trans; }
+			matrix[0] *= m_scale.x;
+			matrix[1] *= m_scale.y;
+			matrix[2] *= m_scale.z;
+			matrix[3] = glm::vec4{m_translation, 1.f};
 
+			if(m_specificTransformation) { matrix *= *m_specificTransformation; }
+			return matrix;
+		}
 
-    glm::mat4 getTransformationMatrix() const { return m_translation * glm::toMat4(m_rotation) * m_scale * m_specificTransformation; }
+		glm::vec3 m_translation;
+		glm::quat m_rotation;
+		glm::vec3 m_scale;
+		std::unique_ptr<glm::mat4> m_specificTransformation;
 
-	glm::mat4 m_translation, m_scale, m_specificTransformation;
-    glm::quat m_rotation;
+		glm::mat4 m_matrix;
+		bool m_needUpdate;
 };
 
 }}
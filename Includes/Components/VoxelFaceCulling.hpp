@@ -0,0 +1,54 @@
+#ifndef VOXEL_FACE_CULLING_HPP
+#define VOXEL_FACE_CULLING_HPP
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Components/VoxelMap.hpp"
+
+// Visible faces of every voxel of a chunk, as one bit mask per column and direction.
+// The occupancy columns of the chunk are copied with one voxel of margin on each side, the
+// voxels outside of the world being empty, then each direction is solid & ~neighbourSolid:
+// a shift along z, the next or previous column along x and y.
+// The kernel runs on 1, 2 (SSE2) or 4 (AVX2) columns at a time, the best one the CPU supports
+// being chosen at run time. All of them give the same masks.
+
+class VoxelFaceCulling {
+
+	public:
+
+		enum class Kernel { Scalar, SSE2, AVX2 };
+
+		VoxelFaceCulling();
+
+		static bool isSupported(const Kernel kernel);
+		static Kernel getBestKernel();
+
+		void setKernel(const Kernel kernel);
+		Kernel getKernel() const;
+
+		void cull(const VoxelMap &map, const unsigned int chunk);
+
+		// Bit z is set when the voxel (x, y, z) of the chunk, in chunk coordinates, has a visible face
+		// in the direction (+x, -x, +y, -y, +z, -z)
+		std::uint32_t getFaces(const unsigned int direction, const unsigned int x, const unsigned int y) const {
+
+			return m_faces[(direction*VoxelMap::ChunkSize + x)*VoxelMap::ChunkSize + y];
+		}
+
+		// Faces of the six directions together
+		std::uint32_t getAllFaces(const unsigned int x, const unsigned int y) const;
+
+	private:
+
+		static constexpr unsigned int PaddedSize{VoxelMap::ChunkSize + 2};
+
+		Kernel m_kernel;
+
+		// Bit 0 is the voxel under the chunk and bit ChunkSize + 1 the one over it
+		std::array<std::uint64_t, PaddedSize*PaddedSize> m_columns;
+		std::array<std::uint32_t, 6*VoxelMap::ChunkSize*VoxelMap::ChunkSize> m_faces;
+};
+
+#endif
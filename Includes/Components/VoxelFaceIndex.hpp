@@ -0,0 +1,44 @@
+#ifndef VOXEL_FACE_INDEX_HPP
+#define VOXEL_FACE_INDEX_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Face of a chunk mesh drawn for each (voxel, direction) of the chunk.
+// Open addressing with linear probing on a power of two table, erasing shifts the following
+// entries back so no tombstone is left. Directions go +x, -x, +y, -y, +z, -z.
+
+class VoxelFaceIndex {
+
+	public:
+
+		static constexpr unsigned int NoFace{std::numeric_limits<unsigned int>::max()};
+
+		VoxelFaceIndex();
+
+		void insert(const unsigned int localVoxel, const unsigned int direction, const unsigned int face);
+		unsigned int find(const unsigned int localVoxel, const unsigned int direction) const;
+
+		// Returns the face which was removed, or NoFace
+		unsigned int erase(const unsigned int localVoxel, const unsigned int direction);
+
+		void clear();
+		size_t size() const;
+
+	private:
+
+		static constexpr std::uint32_t EmptyKey{std::numeric_limits<std::uint32_t>::max()};
+
+		static std::uint32_t makeKey(const unsigned int localVoxel, const unsigned int direction);
+		size_t getSlot(const std::uint32_t key) const;
+		void grow();
+
+		std::vector<std::uint32_t> m_keys;
+		std::vector<std::uint32_t> m_faces;
+		size_t m_size;
+		unsigned int m_shift;
+};
+
+#endif
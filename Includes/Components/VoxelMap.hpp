@@ -2,6 +2,11 @@
 #define VOXEL_MAP_HPP
 
 #include <vector>
+#include <array>
+#include <map>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
 #include <stdexcept>
 #include <ctime>
 #include <random>
@@ -10,19 +15,62 @@
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
 
+#include "GulgEngine/GulgDeclarations.hpp"
 #include "Components/Component.hpp"
+#include "Components/VoxelFaceIndex.hpp"
+
+// Voxels only store an index in a palette of colors, on 8 bits while the palette has at most
+// 256 colors and on 16 bits after that. The palette grows with each new color and index 0 is
+// always the empty voxel.
+// The world is split into chunks of at most ChunkSize^3 voxels, each one with its own indices and mesh.
+// Voxel ids stay global: x*sizeY*sizeZ + y*sizeZ + z.
+// Culled chunks get one quad per visible voxel face and can be remeshed voxel by voxel. Greedy
+// chunks merge coplanar faces of the same color into rectangles, so any edit remeshes them whole.
+// A voxel is solid when its alpha isn't 0. Solidity is also kept as one bit per voxel, packed
+// along z in 64 bits words per (x, y) column, so solid queries are plain bit operations.
+
+enum class VoxelMeshing { Culled, Greedy };
+
+struct VoxelChunk {
+
+	std::array<unsigned int, 3> origin;
+
+	// Smaller than ChunkSize for the chunks on the far sides of the world
+	std::array<unsigned int, 3> size;
+
+	// Chunk index in the directions +x, -x, +y, -y, +z, -z, or VoxelMap::NoChunk
+	std::array<unsigned int, 6> neighbours;
+
+	// size[0]*size[1]*size[2] palette indices, or nothing while every voxel of the chunk is empty
+	std::vector<std::uint8_t> indices;
+	std::vector<std::uint16_t> wideIndices;
+
+	// Voxels whose faces changed since the last meshing. Not filled while the whole chunk has to be meshed
+	std::vector<unsigned int> editedVoxels;
+	bool needFullMesh;
+	VoxelMeshing meshing;
+
+	// Incremented each time the chunk is meshed, so meshes built from it can tell they're outdated
+	unsigned int meshVersion;
+
+	Gg::Entity meshEntity;
+	VoxelFaceIndex faces;
+};
 
 class VoxelMap: public Gg::Component::AbstractComponent{
 
 	public:
 
+		static constexpr unsigned int ChunkSize{32};
+		static constexpr unsigned int NoChunk{std::numeric_limits<unsigned int>::max()};
+
 		VoxelMap(const unsigned int x, const unsigned int y, const unsigned int z);
 
 		VoxelMap(const VoxelMap &map);
 
 		virtual std::shared_ptr<AbstractComponent> clone() const{
 
-			return std::static_pointer_cast<Gg::Component::AbstractComponent>(std::make_shared<VoxelMap>(*this));
+			return std::static_pointer_cast<Gg::Component::AbstractComponent>(Gg::makeComponent<VoxelMap>(*this));
 		}
 
 		glm::vec4 getColor(const unsigned int x, const unsigned int y, const unsigned int z) const;
@@ -33,17 +81,96 @@ class VoxelMap: public Gg::Component::AbstractComponent{
 
 		unsigned int getVoxelID(const unsigned int x, const unsigned int y, const unsigned int z) const;
 
+		bool isSolid(const unsigned int x, const unsigned int y, const unsigned int z) const;
+		bool isSolid(const unsigned int voxelID) const;
+
+		// Bit i is set when voxel (x, y, word*64 + i) is solid
+		std::uint64_t getColumnMask(const unsigned int x, const unsigned int y, const unsigned int word = 0) const;
+		unsigned int getNbColumnWords() const;
+
+		// The getNbColumnWords() words of the column, for loops going through many columns
+		const std::uint64_t *getColumn(const unsigned int x, const unsigned int y) const;
+
+		// Boxes go from min included to max excluded, and are clamped to the world
+		bool anySolid(const std::array<unsigned int, 3> &min, const std::array<unsigned int, 3> &max) const;
+
+		// Calls function(x, y, z) for each solid voxel of the box, in x, y then z order
+		template<typename Function>
+		void forEachSolid(const std::array<unsigned int, 3> &min, const std::array<unsigned int, 3> &max, Function function) const {
+
+			const unsigned int maxX{std::min(max[0], m_sizeX)}, maxY{std::min(max[1], m_sizeY)}, maxZ{std::min(max[2], m_sizeZ)};
+
+			for(unsigned int x{min[0]}; x < maxX; x++) {
+				for(unsigned int y{min[1]}; y < maxY; y++) {
+					for(unsigned int word{min[2]/64}; word*64 < maxZ; word++) {
+
+						std::uint64_t bits{m_occupancy[(x*m_sizeY + y)*m_nbColumnWords + word] & getRangeMask(word, min[2], maxZ)};
+
+						while(bits != 0) {
+
+							function(x, y, word*64 + static_cast<unsigned int>(__builtin_ctzll(bits)));
+							bits &= bits - 1;
+						}
+					}
+				}
+			}
+		}
+
+		unsigned int getPaletteIndex(const unsigned int x, const unsigned int y, const unsigned int z) const;
+		unsigned int getPaletteIndex(const unsigned int voxelID) const;
+		const std::vector<glm::vec4> &getPalette() const;
+
 		glm::vec3 getVoxelPosition(const unsigned int voxelID) const;
 
 		std::array<unsigned int, 3> getWorldDimensions() const;
 
 		std::vector<unsigned int> explode(unsigned int x,unsigned int y, unsigned int z,int explosivePower);
 
-		std::vector< std::vector<unsigned int>> idVoxel_vertexInds;
+		size_t getNbChunks() const;
+		const VoxelChunk &getChunk(const unsigned int chunk) const;
+		unsigned int getChunkOfVoxel(const unsigned int voxelID) const;
+		unsigned int getLocalVoxel(const unsigned int voxelID) const;
+		std::vector<unsigned int> getVoxelsOfChunk(const unsigned int chunk) const;
+
+		void setChunkMeshEntity(const unsigned int chunk, const Gg::Entity entity);
+		VoxelFaceIndex &getChunkFaces(const unsigned int chunk);
+
+		// Changing the meshing of a chunk asks for a full mesh of it
+		void setChunkMeshing(const unsigned int chunk, const VoxelMeshing meshing);
+		VoxelMeshing getChunkMeshing(const unsigned int chunk) const;
+
+		bool chunkIsDirty(const unsigned int chunk) const;
+		std::vector<unsigned int> getDirtyChunks() const;
+
+		// Sorted without duplicates, the chunk is clean afterwards
+		std::vector<unsigned int> takeEditedVoxels(const unsigned int chunk);
+		void setChunkMeshed(const unsigned int chunk);
 
 	private:
 
-		std::vector<glm::vec4> m_voxels;
+		static constexpr size_t MaxPaletteSize{65536};
+
+		unsigned int getIndex(const unsigned int x, const unsigned int y, const unsigned int z) const;
+		unsigned int getChunkIndex(const unsigned int x, const unsigned int y, const unsigned int z) const;
+		unsigned int getStorageIndex(const VoxelChunk &chunk, const unsigned int x, const unsigned int y, const unsigned int z) const;
+		void recordEdit(const unsigned int x, const unsigned int y, const unsigned int z);
+
+		static std::uint64_t getRangeMask(const unsigned int word, const unsigned int minZ, const unsigned int maxZ);
+
+		unsigned int findOrAddColor(const glm::vec4 &color);
+		void checkVoxelID(const unsigned int voxelID) const;
+		void checkChunk(const unsigned int chunk) const;
+
+		std::vector<VoxelChunk> m_chunks;
+		std::array<unsigned int, 3> m_nbChunks;
+		bool m_useWideIndices;
+
+		std::vector<std::uint64_t> m_occupancy;
+		unsigned int m_nbColumnWords;
+
+		std::vector<glm::vec4> m_palette;
+		std::vector<bool> m_paletteIsSolid;
+		std::map<std::array<float, 4>, unsigned int> m_paletteIndices;
 
 		const unsigned int m_sizeX, m_sizeY, m_sizeZ;
 
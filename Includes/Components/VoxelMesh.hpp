@@ -0,0 +1,275 @@
+#ifndef VOXEL_MESH_COMPONENTS_HPP
+#define VOXEL_MESH_COMPONENTS_HPP
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include <GL/glew.h>
+#include <GL/gl.h>
+
+#include <glm/vec3.hpp>
+#include <glm/glm.hpp>
+
+#include "Components/Mesh.hpp"
+
+namespace Gg {
+
+namespace Component {
+
+// 8 bytes vertex decoded by voxelVertex.vert. position holds the corner of the face in voxels
+// on 6 bits per axis (x, then y, then z) followed by the face direction on 3 bits
+// (+x, -x, +y, -y, +z, -z). The corner at (0, 0, 0) is the one of a voxel centered on the origin.
+// color is RGBA8, red in the low byte.
+
+struct VoxelVertex {
+
+	std::uint32_t position;
+	std::uint32_t color;
+};
+
+// Mesh made of quads of voxel faces. Indices are on 16 bits while the mesh has at most
+// 65536 vertices, and on 32 bits after that. Stored as a MainMesh, so it is read back with
+// GulgEngine::getComponentAs<Mesh, VoxelMesh> or PrefabInstance::getAs<Mesh, VoxelMesh>.
+// Hidden faces leave a free slot that the next added face takes, so a face keeps its slot
+// until it's hidden and the indices of a slot never change. Uploads only send the slots
+// changed since the last one, plus the faces added at the end.
+
+struct VoxelMesh: public Mesh {
+
+	static constexpr size_t MaxShortIndexVertices{65536};
+
+	VoxelMesh(GLuint program):
+		Mesh{program},
+		m_useLongIndices{false},
+		m_bufferFaces{0},
+		m_uploadedFaces{0},
+		m_needFullUpload{true} {}
+
+	VoxelMesh(const VoxelMesh &mesh):
+		Mesh{mesh},
+		m_vertices{mesh.m_vertices},
+		m_shortIndices{mesh.m_shortIndices},
+		m_longIndices{mesh.m_longIndices},
+		m_useLongIndices{mesh.m_useLongIndices},
+		m_freeFaces{mesh.m_freeFaces},
+		m_bufferFaces{0},
+		m_uploadedFaces{0},
+		m_needFullUpload{true} {}
+
+	virtual std::shared_ptr<AbstractComponent> clone() const {
+
+		return std::static_pointer_cast<AbstractComponent>(Gg::makeComponent<VoxelMesh>(*this));
+	}
+
+	static VoxelVertex packVertex(const std::array<unsigned int, 3> &corner, const unsigned int direction, const std::uint32_t color) {
+
+		return VoxelVertex{corner[0] | corner[1] << 6 | corner[2] << 12 | direction << 18, color};
+	}
+
+	static std::uint32_t packColor(const glm::vec3 &color) {
+
+		const glm::vec3 bytes{glm::round(glm::clamp(color, 0.f, 1.f)*255.f)};
+		return static_cast<std::uint32_t>(bytes.r) | static_cast<std::uint32_t>(bytes.g) << 8 | static_cast<std::uint32_t>(bytes.b) << 16 | 0xFF000000u;
+	}
+
+	void clear() {
+
+		m_vertices.clear();
+		m_shortIndices.clear();
+		m_longIndices.clear();
+		m_useLongIndices = false;
+
+		m_freeFaces.clear();
+		m_dirtyFaces.clear();
+		m_needFullUpload = true;
+	}
+
+	void reserveFaces(const size_t nbFaces) {
+
+		const size_t nbVertices{m_vertices.size() + nbFaces*4};
+
+		if(nbVertices > MaxShortIndexVertices) { useLongIndices(); }
+
+		m_vertices.reserve(nbVertices);
+
+		if(m_useLongIndices) { m_longIndices.reserve(m_longIndices.size() + nbFaces*6); }
+		else { m_shortIndices.reserve(m_shortIndices.size() + nbFaces*6); }
+	}
+
+	// Returns the index of the new face
+	unsigned int addFace(const std::array<VoxelVertex, 4> &vertices) {
+
+		if(!m_freeFaces.empty()) {
+
+			const unsigned int face{m_freeFaces.back()};
+			m_freeFaces.pop_back();
+
+			std::copy(vertices.begin(), vertices.end(), m_vertices.begin() + face*4);
+			m_dirtyFaces.emplace_back(face);
+
+			return face;
+		}
+
+		const unsigned int face = m_vertices.size()/4;
+		const std::uint32_t first{face*4};
+
+		if(!m_useLongIndices && m_vertices.size() + 4 > MaxShortIndexVertices) { useLongIndices(); }
+
+		m_vertices.insert(m_vertices.end(), vertices.begin(), vertices.end());
+
+		if(m_useLongIndices) { m_longIndices.insert(m_longIndices.end(), {first, first + 1, first + 2, first, first + 2, first + 3}); }
+		else {
+
+			const std::uint16_t shortFirst{static_cast<std::uint16_t>(first)};
+			m_shortIndices.insert(m_shortIndices.end(), {shortFirst, static_cast<std::uint16_t>(shortFirst + 1), static_cast<std::uint16_t>(shortFirst + 2),
+			                                             shortFirst, static_cast<std::uint16_t>(shortFirst + 2), static_cast<std::uint16_t>(shortFirst + 3)});
+		}
+
+		return face;
+	}
+
+	// The four vertices are moved to the same point, so the face isn't drawn anymore, and its slot is freed
+	void hideFace(const unsigned int face) {
+
+		for(unsigned int i{0}; i < 4; i++) { m_vertices[face*4 + i].position = 0; }
+
+		m_freeFaces.emplace_back(face);
+		m_dirtyFaces.emplace_back(face);
+	}
+
+	void setColor(const glm::vec3 &color) {
+
+		const std::uint32_t packedColor{packColor(color)};
+		for(VoxelVertex &vertex: m_vertices) { vertex.color = packedColor; }
+
+		m_needFullUpload = true;
+		reshape();
+	}
+
+	// Once a quarter of the slots are free, meshing the chunk again gives a smaller mesh
+	bool needsCompaction() const { return m_freeFaces.size()*4 > getNbFaces(); }
+
+	size_t getNbFaces() const { return m_vertices.size()/4; }
+	size_t getNbFreeFaces() const { return m_freeFaces.size(); }
+	size_t getNbVertices() const { return m_vertices.size(); }
+	size_t getNbIndices() const { return m_useLongIndices ? m_longIndices.size() : m_shortIndices.size(); }
+
+	protected:
+
+	virtual bool isEmpty() const { return getNbIndices() == 0; }
+
+	virtual void drawElements() {
+
+	    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndiceID);
+	    glDrawElements(GL_TRIANGLES, getNbIndices(), m_useLongIndices ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT, reinterpret_cast<void*>(0));
+	}
+
+	virtual void createBuffers() {
+
+		m_modelMatrixID = glGetUniformLocation(m_program, "ModelMatrix");
+		m_viewMatrixID = glGetUniformLocation(m_program, "ViewMatrix");
+		m_projectionMatrixID = glGetUniformLocation(m_program, "ProjectionMatrix");
+
+		glGenVertexArrays(1, &m_vertexArrayID);
+		glGenBuffers(1, &m_vertexPositionID);
+		glGenBuffers(1, &m_vertexIndiceID);
+
+		glBindVertexArray(m_vertexArrayID);
+
+	    glBindBuffer(GL_ARRAY_BUFFER, m_vertexPositionID);
+	    glEnableVertexAttribArray(0);
+	    glVertexAttribIPointer(0, 1, GL_UNSIGNED_INT, sizeof(VoxelVertex), reinterpret_cast<void*>(offsetof(VoxelVertex, position)));
+	    glEnableVertexAttribArray(1);
+	    glVertexAttribIPointer(1, 1, GL_UNSIGNED_INT, sizeof(VoxelVertex), reinterpret_cast<void*>(offsetof(VoxelVertex, color)));
+	}
+
+	virtual size_t upload() {
+
+		const size_t nbFaces{getNbFaces()}, indexSize{m_useLongIndices ? sizeof(std::uint32_t) : sizeof(std::uint16_t)};
+		size_t uploadedBytes{0};
+
+		glBindVertexArray(m_vertexArrayID);
+	    glBindBuffer(GL_ARRAY_BUFFER, m_vertexPositionID);
+	    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vertexIndiceID);
+
+		// The buffers keep some room, so the next added faces don't reallocate them
+
+		if(m_needFullUpload || nbFaces > m_bufferFaces) {
+
+			m_bufferFaces = nbFaces + nbFaces/4;
+			m_uploadedFaces = 0;
+			m_needFullUpload = false;
+
+		    glBufferData(GL_ARRAY_BUFFER, m_bufferFaces*4*sizeof(VoxelVertex), nullptr, GL_DYNAMIC_DRAW);
+		    glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_bufferFaces*6*indexSize, nullptr, GL_DYNAMIC_DRAW);
+		}
+
+		else {
+
+			// Consecutive slots are sent together
+
+			std::sort(m_dirtyFaces.begin(), m_dirtyFaces.end());
+			m_dirtyFaces.erase(std::unique(m_dirtyFaces.begin(), m_dirtyFaces.end()), m_dirtyFaces.end());
+
+			for(size_t i{0}; i < m_dirtyFaces.size() && m_dirtyFaces[i] < m_uploadedFaces;) {
+
+				size_t end{i + 1};
+				while(end < m_dirtyFaces.size() && m_dirtyFaces[end] == m_dirtyFaces[end - 1] + 1 && m_dirtyFaces[end] < m_uploadedFaces) { end++; }
+
+				const size_t size{(end - i)*4*sizeof(VoxelVertex)};
+			    glBufferSubData(GL_ARRAY_BUFFER, m_dirtyFaces[i]*4*sizeof(VoxelVertex), size, m_vertices.data() + m_dirtyFaces[i]*4);
+
+				uploadedBytes += size;
+				i = end;
+			}
+		}
+
+		m_dirtyFaces.clear();
+
+		if(m_uploadedFaces < nbFaces) {
+
+			const size_t verticesSize{(nbFaces - m_uploadedFaces)*4*sizeof(VoxelVertex)}, indicesSize{(nbFaces - m_uploadedFaces)*6*indexSize};
+			const void *indices{m_useLongIndices ? static_cast<const void*>(m_longIndices.data() + m_uploadedFaces*6) : static_cast<const void*>(m_shortIndices.data() + m_uploadedFaces*6)};
+
+		    glBufferSubData(GL_ARRAY_BUFFER, m_uploadedFaces*4*sizeof(VoxelVertex), verticesSize, m_vertices.data() + m_uploadedFaces*4);
+		    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, m_uploadedFaces*6*indexSize, indicesSize, indices);
+
+			uploadedBytes += verticesSize + indicesSize;
+			m_uploadedFaces = nbFaces;
+		}
+
+		return uploadedBytes;
+	}
+
+	void useLongIndices() {
+
+		if(m_useLongIndices) { return; }
+
+		m_longIndices.assign(m_shortIndices.begin(), m_shortIndices.end());
+		std::vector<std::uint16_t>{}.swap(m_shortIndices);
+		m_useLongIndices = true;
+		m_needFullUpload = true;
+	}
+
+	public:
+
+	std::vector<VoxelVertex> m_vertices;
+	std::vector<std::uint16_t> m_shortIndices;
+	std::vector<std::uint32_t> m_longIndices;
+
+	bool m_useLongIndices;
+
+	std::vector<unsigned int> m_freeFaces;
+
+	// Slots changed since the last upload, and the GPU side of the mesh
+	std::vector<unsigned int> m_dirtyFaces;
+	size_t m_bufferFaces, m_uploadedFaces;
+	bool m_needFullUpload;
+};
+
+}}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef COMMAND_BUFFER_HPP
+#define COMMAND_BUFFER_HPP
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+
+#include "GulgEngine/GulgDeclarations.hpp"
+#include "GulgEngine/EntityCreator.hpp"
+#include "GulgEngine/Prefab.hpp"
+#include "Components/Component.hpp"
+#include "Components/ComponentTypes.hpp"
+
+namespace Gg {
+
+// Structural changes recorded during a frame and applied by GulgEngine::applyCommands().
+// Recording is thread safe. Entities are reserved at once, so later commands can use them,
+// but they only get a signature, components and query membership at playback.
+
+enum class CommandType { CreateEntity, AddComponent, DeleteComponent, DeleteEntity };
+
+struct Command {
+
+	CommandType type;
+	Entity entity;
+	ComponentID component;
+	std::shared_ptr<Component::AbstractComponent> value;
+	size_t order;
+};
+
+class CommandBuffer {
+
+	public:
+
+		CommandBuffer(EntityCreator &entityCreator);
+
+		Entity createEntity();
+		std::vector<Entity> createEntities(const unsigned int nbEntities);
+
+		void addComponent(const Entity entity, const ComponentID id, std::shared_ptr<Component::AbstractComponent> component);
+		void deleteComponent(const Entity entity, const ComponentID id);
+		void deleteEntity(const Entity entity);
+
+		// The components are copied and init is called at once, by the recording thread.
+		std::vector<Entity> instantiate(const Prefab &prefab, const unsigned int nbEntities, const PrefabInit &init = nullptr);
+
+		template<typename T>
+		void addComponent(const Entity entity, std::shared_ptr<T> component) { addComponent(entity, Component::ComponentType<T>::id, std::move(component)); }
+
+		template<typename T>
+		void deleteComponent(const Entity entity) { deleteComponent(entity, Component::ComponentType<T>::id); }
+
+		// Gives the recorded commands, creations first, then sorted by entity and record order,
+		// and empties the buffer.
+		std::vector<Command> takeCommands();
+		std::vector<PrefabBatch> takePrefabBatches();
+
+		bool empty() const;
+
+	private:
+
+		void record(const CommandType type, const Entity entity, const ComponentID id, std::shared_ptr<Component::AbstractComponent> component);
+
+		EntityCreator &m_entityCreator;
+
+		std::vector<Command> m_commands;
+		std::vector<PrefabBatch> m_prefabBatches;
+		mutable std::mutex m_mutex;
+};
+
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef COMPONENT_ALLOCATOR_HPP
+#define COMPONENT_ALLOCATOR_HPP
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+
+namespace Gg {
+
+// Fixed size blocks carved from chunks of BlocksPerChunk blocks. Freed blocks are kept
+// in a free list and given back by the next allocation, so the global heap is only
+// touched when every block is in use. Thread safe.
+
+class BlockPool {
+
+	public:
+
+		static constexpr size_t BlocksPerChunk{256};
+
+		BlockPool(const size_t blockSize, const size_t blockAlignment);
+
+		BlockPool(const BlockPool &) = delete;
+		void operator=(const BlockPool &) = delete;
+
+		void *allocate();
+		void deallocate(void *block);
+
+	private:
+
+		struct FreeBlock { FreeBlock *next; };
+
+		void addChunk();
+
+		const size_t m_blockSize;
+
+		std::mutex m_mutex;
+		FreeBlock *m_freeBlocks;
+		std::vector<std::unique_ptr<unsigned char[]>> m_chunks;
+};
+
+// Counted since the start of the program. The difference between two frames gives
+// the allocations of a frame. componentAllocations is also what make_shared would have
+// asked to the global heap, heapAllocations is what the pools really asked.
+
+struct AllocationCounters {
+
+	size_t componentAllocations;
+	size_t componentDeallocations;
+	size_t heapAllocations;
+
+	AllocationCounters operator-(const AllocationCounters &second) const;
+};
+
+AllocationCounters getAllocationCounters();
+
+namespace Allocation {
+
+	void countAllocation(const bool fromHeap);
+	void countDeallocation();
+
+	// One pool per type. With allocate_shared, the type is the control block holding the component.
+
+	template<typename T>
+	BlockPool &getBlockPool() {
+
+		static BlockPool pool{sizeof(T), alignof(T)};
+		return pool;
+	}
+}
+
+template<typename T>
+class PoolAllocator {
+
+	public:
+
+		using value_type = T;
+
+		PoolAllocator() {}
+
+		template<typename U>
+		PoolAllocator(const PoolAllocator<U> &) {}
+
+		T *allocate(const size_t number) {
+
+			if(number != 1) {
+
+				Allocation::countAllocation(true);
+				return static_cast<T*>(::operator new(number*sizeof(T)));
+			}
+
+			return static_cast<T*>(Allocation::getBlockPool<T>().allocate());
+		}
+
+		void deallocate(T *pointer, const size_t number) {
+
+			Allocation::countDeallocation();
+
+			if(number != 1) { ::operator delete(pointer); }
+			else { Allocation::getBlockPool<T>().deallocate(pointer); }
+		}
+
+		template<typename U>
+		bool operator==(const PoolAllocator<U> &) const { return true; }
+
+		template<typename U>
+		bool operator!=(const PoolAllocator<U> &) const { return false; }
+};
+
+// Replaces std::make_shared for components: the component and its reference counts share one pooled block.
+
+template<typename T, typename... Args>
+std::shared_ptr<T> makeComponent(Args&&... args) { return std::allocate_shared<T>(PoolAllocator<T>{}, std::forward<Args>(args)...); }
+
+}
+
+#endif
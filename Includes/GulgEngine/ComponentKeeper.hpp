@@ -2,10 +2,12 @@
 #define COMPONENT_KEEPER_HPP
 
 #include <string>
-#include <map>
+#include <vector>
 #include <memory>
+#include <stdexcept>
 
 #include "GulgEngine/GulgDeclarations.hpp"
+#include "GulgEngine/ComponentPool.hpp"
 #include "Components/Component.hpp"
 
 namespace Gg {
@@ -16,26 +18,26 @@ class ComponentKeeper {
 
 		ComponentKeeper();
 
-		void addEntity(const Entity entity);
-		void addComponent(const Entity entity, const std::string name, std::shared_ptr<Component::AbstractComponent> newComponent);
+		void resetComponentTypes(const size_t numberOfTypes);
+
+		void addComponent(const Entity entity, const ComponentID id, std::shared_ptr<Component::AbstractComponent> newComponent);
 
 		void deleteEntity(const Entity entity);
-		void deleteComponent(const Entity entity, const std::string name);
+		void deleteComponent(const Entity entity, const ComponentID id);
 
-		bool entityExist(const Entity entity) const;
-		bool entityHasComponent(const Entity entity, const std::string name) const;
+		bool entityHasComponent(const Entity entity, const ComponentID id) const;
 
 		void cloneEntity(const Entity entityToClone, const Entity clone);
-		
 
-		std::shared_ptr<Component::AbstractComponent> getComponent(const Entity entity, const std::string name) const;
+		const std::shared_ptr<Component::AbstractComponent> &getComponent(const Entity entity, const ComponentID id) const;
+		const ComponentPool &getPool(const ComponentID id) const;
+		void reserve(const ComponentID id, const size_t nbComponents);
 
 	private:
 
-		std::map<Entity, std::map<std::string, std::shared_ptr<Component::AbstractComponent>>> m_components;
-                              
+		std::vector<ComponentPool> m_pools;
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,49 @@
+#ifndef COMPONENT_POOL_HPP
+#define COMPONENT_POOL_HPP
+
+#include <vector>
+#include <memory>
+#include <limits>
+
+#include "GulgEngine/GulgDeclarations.hpp"
+#include "Components/Component.hpp"
+
+namespace Gg {
+
+// Sparse set holding every component of one type.
+// Pointers to the components are packed in m_components, m_entities gives the owner of each slot
+// and m_sparse maps an entity index to its slot (NoIndex if it has no component of this type).
+// Removing swaps the last slot in the hole, so the dense arrays never have gaps.
+// The components themselves come from makeComponent (ComponentAllocator.hpp), whose BlockPool
+// for the type supplies the contiguity: components of one type share chunks of 256 blocks.
+
+class ComponentPool {
+
+	public:
+
+		static constexpr unsigned int NoIndex{std::numeric_limits<unsigned int>::max()};
+
+		ComponentPool();
+
+		void add(const Entity entity, std::shared_ptr<Component::AbstractComponent> newComponent);
+		void remove(const Entity entity);
+
+		bool has(const Entity entity) const;
+
+		const std::shared_ptr<Component::AbstractComponent> &get(const Entity entity) const;
+
+		size_t size() const;
+		void reserve(const size_t nbComponents);
+		const std::vector<Entity> &getEntities() const;
+		const std::vector<std::shared_ptr<Component::AbstractComponent>> &getComponents() const;
+
+	private:
+
+		std::vector<Entity> m_entities;
+		std::vector<std::shared_ptr<Component::AbstractComponent>> m_components;
+		std::vector<unsigned int> m_sparse;
+};
+
+}
+
+#endif
@@ -2,8 +2,9 @@
 #define ENTITY_CREATOR_HPP
 
 #include <stdexcept>
-#include <deque>
+#include <vector>
 #include <string>
+#include <mutex>
 
 #include "GulgEngine/GulgDeclarations.hpp"
 
@@ -20,15 +21,25 @@ class EntityCreator {
 		void freeEntity(const Entity freeEntity);
 
 		Entity createEntity();
+		std::vector<Entity> createEntities(const unsigned int nbEntities);
+
+		bool isAlive(const Entity entity) const;
+
 		size_t nbRemainingEntities() const;
 
 	private:
-                              
-		std::deque<Entity> m_nextEntities;
-		unsigned int m_nbMaximalEntity;
 
+		// Callers hold m_mutex
+		void reserve(const unsigned int entityReserveSize);
+		bool entityIsAlive(const Entity entity) const;
+
+		std::vector<unsigned int> m_generations;
+		std::vector<bool> m_alive;
+		std::vector<unsigned int> m_freeIndices;
+
+		mutable std::mutex m_mutex;
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,52 @@
+#ifndef ENTITY_QUERY_HPP
+#define ENTITY_QUERY_HPP
+
+#include <vector>
+#include <limits>
+
+#include "GulgEngine/Signature.hpp"
+#include "GulgEngine/GulgDeclarations.hpp"
+
+namespace Gg {
+
+// Packed list of entities with an entity index -> position map, so adding, removing
+// and testing an entity are O(1). Removing moves the last entity in the hole.
+// Once subscribed to the GulgEngine, the list follows every entity whose signature contains getSignature().
+
+class EntityQuery {
+
+	public:
+
+		static constexpr unsigned int NoIndex{std::numeric_limits<unsigned int>::max()};
+
+		EntityQuery();
+
+		void setSignature(const Signature &signature);
+		const Signature &getSignature() const;
+
+		void add(const Entity entity);
+		void remove(const Entity entity);
+		void clear();
+
+		bool has(const Entity entity) const;
+
+		size_t size() const;
+		bool empty() const;
+
+		Entity operator[](const size_t index) const;
+
+		std::vector<Entity>::const_iterator begin() const;
+		std::vector<Entity>::const_iterator end() const;
+
+		const std::vector<Entity> &getEntities() const;
+
+	private:
+
+		Signature m_signature;
+		std::vector<Entity> m_entities;
+		std::vector<unsigned int> m_sparse;
+};
+
+}
+
+#endif
@@ -2,7 +2,8 @@
 #define ENTITY_SIGNATURE_KEEPER_HPP
 
 #include <string>
-#include <map>
+#include <vector>
+#include <stdexcept>
 
 #include "GulgEngine/Signature.hpp"
 #include "GulgEngine/GulgDeclarations.hpp"
@@ -27,13 +28,17 @@ class EntitySignatureKeeper {
 
 		void cloneEntity(const Entity entityToClone, const Entity clone);
 		
-		Signature getSignature(const Entity entity) const;
+		const Signature &getSignature(const Entity entity) const;
+		const std::vector<Entity> &getEntities() const;
 
 	private:
 
-		std::map<Entity, Signature> m_signatures;
+		// Both indexed by the entity index, m_entities keeps the handle owning the slot
+
+		std::vector<Entity> m_entities;
+		std::vector<Signature> m_signatures;
 		size_t m_signatureSize;
-                              
+
 };
 
 }
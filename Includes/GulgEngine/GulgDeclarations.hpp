@@ -6,8 +6,25 @@ namespace Gg {
 	#define Pi 3.141592
 	#define NoEntity Entity{0}
 
+	// An entity packs the index of its slot (low bits) and the generation of that slot (high bits).
+	// The generation changes each time the slot is freed, so old handles stop being alive.
+	// Index 0 is never given, which keeps NoEntity invalid.
+
 	using Entity = unsigned int;
+	using ComponentID = unsigned int;
+
+	constexpr unsigned int EntityIndexBits{20};
+	constexpr unsigned int EntityGenerationBits{12};
+	constexpr unsigned int EntityIndexMask{(1u << EntityIndexBits) - 1};
+	constexpr unsigned int EntityGenerationMask{(1u << EntityGenerationBits) - 1};
+
+	constexpr unsigned int getEntityIndex(const Entity entity) { return entity & EntityIndexMask; }
+	constexpr unsigned int getEntityGeneration(const Entity entity) { return entity >> EntityIndexBits; }
+	constexpr Entity makeEntity(const unsigned int index, const unsigned int generation) {
+
+		return ((generation & EntityGenerationMask) << EntityIndexBits) | (index & EntityIndexMask);
+	}
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -1,6 +1,10 @@
 #ifndef GULG_ENGINE_HPP
 #define GULG_ENGINE_HPP
 
+#include <vector>
+#include <map>
+#include <algorithm>
+
 #include <GL/glew.h>
 #include <GL/gl.h>
 
@@ -10,10 +14,18 @@
 #include "GulgEngine/EntitySignatureKeeper.hpp"
 #include "GulgEngine/SignatureLoader.hpp"
 #include "GulgEngine/ComponentKeeper.hpp"
+#include "GulgEngine/View.hpp"
+#include "GulgEngine/EntityQuery.hpp"
+#include "GulgEngine/CommandBuffer.hpp"
+#include "GulgEngine/Prefab.hpp"
+#include "GulgEngine/SceneGraph.hpp"
+#include "GulgEngine/JobSystem.hpp"
+#include "GulgEngine/ComponentAllocator.hpp"
 #include "GulgEngine/ProgramKeeper.hpp"
 #include "GulgEngine/TextureKeeper.hpp"
 
 #include "Components/Component.hpp"
+#include "Components/ComponentTypes.hpp"
 
 namespace Gg {
 
@@ -26,16 +38,72 @@ class GulgEngine {
 		bool loadSignatures(const std::string path);
 
 		Entity getNewEntity();
+		std::vector<Entity> getNewEntities(const unsigned int nbEntities);
 		void deleteEntity(const Entity entity);
+		bool isAlive(const Entity entity) const;
+
+		// Components are used by id. The overloads taking a name look its id up in the signatures
+		// (a std::map search) and call the id ones, so code running often should use the id, or
+		// the template versions, which give ComponentType<T>::id at compile time.
 
+		void addComponentToEntity(const Entity entity, const ComponentID id, std::shared_ptr<Component::AbstractComponent> component);
 		void addComponentToEntity(const Entity entity, const std::string name, std::shared_ptr<Component::AbstractComponent> component);
+		void deleteComponentToEntity(const Entity entity, const ComponentID id);
 		void deleteComponentToEntity(const Entity entity, const std::string name);
-		bool entityHasComponent(const Entity entity, const std::string name);
+		bool entityHasComponent(const Entity entity, const ComponentID id) const;
+		bool entityHasComponent(const Entity entity, const std::string name) const;
+
+		const Signature &getEntitySignature(const Entity entity) const;
+
+		const std::shared_ptr<Component::AbstractComponent> &getComponent(const Entity entity, const ComponentID id) const;
+		const std::shared_ptr<Component::AbstractComponent> &getComponent(const Entity entity, const std::string name) const;
+		const Signature &getComponentSignature(const ComponentID id) const;
+		const Signature &getComponentSignature(const std::string name) const;
+		ComponentID getComponentID(const std::string name) const;
+
+		template<typename T>
+		void addComponentToEntity(const Entity entity, std::shared_ptr<T> component) {
+
+			addComponentToEntity(entity, Component::ComponentType<T>::id, std::static_pointer_cast<Component::AbstractComponent>(std::move(component)));
+		}
+
+		template<typename T>
+		void deleteComponentToEntity(const Entity entity) { deleteComponentToEntity(entity, Component::ComponentType<T>::id); }
+
+		template<typename T>
+		T &getComponent(const Entity entity) const {
+
+			return static_cast<T&>(*getComponent(entity, Component::ComponentType<T>::id));
+		}
+
+		// Component stored as a Stored, which the caller expects to be a T derived from it (a MainMesh
+		// holding a VoxelMesh). Unlike getComponent, the type is checked: throws if it isn't a T.
+
+		template<typename Stored, typename T>
+		T &getComponentAs(const Entity entity) const {
+
+			T *component{dynamic_cast<T*>(&getComponent<Stored>(entity))};
+
+			if(component == nullptr) {
 
-		Signature getEntitySignature(const Entity entity) const;
+				throw std::runtime_error("Gulg error: component " + std::string{Component::ComponentType<Stored>::name} + " of entity " + std::to_string(entity) + " isn't of the asked type.");
+			}
 
-		std::shared_ptr<Component::AbstractComponent> getComponent(const Entity entity, const std::string name) const;
-		Signature getComponentSignature(const std::string name) const;
+			return *component;
+		}
+
+		template<typename T>
+		bool entityHasComponent(const Entity entity) const { return entityHasComponent(entity, Component::ComponentType<T>::id); }
+
+		template<typename T>
+		const Signature &getComponentSignature() const { return getComponentSignature(Component::ComponentType<T>::id); }
+
+		template<typename... Ts>
+		View<Ts...> view() const {
+
+			checkSignatureLoad();
+			return View<Ts...>{{&m_componentKeeper.getPool(Component::ComponentType<Ts>::id)...}};
+		}
 
 		bool loadProgram(const std::string vertexPath, const std::string fragmentPath, const std::string name);
 		GLuint getProgram(const std::string name) const;
@@ -45,16 +113,47 @@ class GulgEngine {
 
 		Entity cloneEntity(const Entity entityToClone);
 
+		void addPrefab(const std::string name, Prefab prefab);
+		const Prefab &getPrefab(const std::string name) const;
+
+		// Creates nbEntities entities from the prefab at once. Use getCommandBuffer().instantiate() during a frame.
+		std::vector<Entity> instantiate(const std::string name, const unsigned int nbEntities, const PrefabInit &init = nullptr);
+
+		void subscribeQuery(EntityQuery &query);
+		void unsubscribeQuery(EntityQuery &query);
+
+		CommandBuffer &getCommandBuffer();
+		void applyCommands();
+
+		const std::vector<Entity> &getLastCreatedEntities() const;
+		const std::vector<Entity> &getLastDeletedEntities() const;
+
+		SceneGraph &getSceneGraph();
+		JobSystem &getJobSystem();
+
 	private:
 
 		void checkSignatureLoad() const;
+		void updateQueries(const Entity entity, const Signature &oldSignature);
+		void addPrefabBatch(PrefabBatch &batch);
 
 		EntityCreator m_entityCreator;
+		CommandBuffer m_commandBuffer;
 		EntitySignatureKeeper m_entitySignatureKeeper;
 		ComponentKeeper m_componentKeeper;
 		SignatureLoader m_signatureLoader;
 		ProgramKeeper m_programKeeper;
 		TextureKeeper m_textureKeeper;
+		SceneGraph m_sceneGraph;
+
+		std::vector<EntityQuery*> m_queries;
+		std::map<std::string, Prefab> m_prefabs;
+
+		std::vector<Entity> m_lastCreatedEntities;
+		std::vector<Entity> m_lastDeletedEntities;
+
+		// Last, so that workers are stopped before anything they could use is destroyed
+		JobSystem m_jobSystem;
 
 		bool m_signaturesAreLoaded;
                               
@@ -0,0 +1,120 @@
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+
+namespace Gg {
+
+// Number of unfinished jobs submitted with it. JobSystem::wait() returns once it reaches 0.
+
+class JobCounter {
+
+	public:
+
+		JobCounter();
+
+		JobCounter(const JobCounter &) = delete;
+		void operator=(const JobCounter &) = delete;
+
+		bool isDone() const;
+
+	private:
+
+		friend class JobSystem;
+
+		std::atomic<unsigned int> m_count;
+};
+
+// Work stealing pool. Each worker owns a deque: it takes its own jobs from the back
+// and steals the oldest jobs of the others from the front. Threads outside of the pool
+// (the main thread) share one more deque, and help running jobs while they wait for a counter.
+// With no worker, jobs are run at once by the thread submitting them.
+
+class JobSystem {
+
+	public:
+
+		JobSystem();
+		JobSystem(const unsigned int nbWorkers);
+		~JobSystem();
+
+		JobSystem(const JobSystem &) = delete;
+		void operator=(const JobSystem &) = delete;
+
+		void submit(std::function<void()> job);
+		void submit(std::function<void()> job, JobCounter &counter);
+
+		void wait(JobCounter &counter);
+
+		// Calls function(begin, end) on consecutive ranges of at most chunkSize indices in [0, size),
+		// returns once every range is done.
+
+		template<typename Function>
+		void parallelFor(const size_t size, const size_t chunkSize, Function function) {
+
+			const size_t step{std::max(chunkSize, size_t{1})};
+
+			if(size <= step || m_workers.empty()) {
+
+				function(size_t{0}, size);
+				return;
+			}
+
+			JobCounter counter;
+
+			for(size_t begin{0}; begin < size; begin += step) {
+
+				const size_t end{std::min(begin + step, size)};
+				submit([&function, begin, end]() { function(begin, end); }, counter);
+			}
+
+			wait(counter);
+		}
+
+		unsigned int getNbWorkers() const;
+
+	private:
+
+		struct Job {
+
+			std::function<void()> function;
+			JobCounter *counter;
+		};
+
+		struct Queue {
+
+			std::mutex mutex;
+			std::deque<Job> jobs;
+		};
+
+		void push(Job job);
+		bool findJob(const size_t queue, Job &job);
+		void runJob(Job &job);
+
+		size_t currentQueue() const;
+
+		void workerLoop(const size_t queue);
+
+		// m_queues[0] is shared by the threads outside of the pool, m_queues[i + 1] belongs to m_workers[i]
+
+		std::vector<std::unique_ptr<Queue>> m_queues;
+		std::vector<std::thread> m_workers;
+
+		std::atomic<size_t> m_nbPendingJobs;
+		std::atomic<bool> m_stop;
+
+		std::mutex m_sleepMutex;
+		std::condition_variable m_sleepCondition;
+};
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef PREFAB_HPP
+#define PREFAB_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <type_traits>
+#include <stdexcept>
+#include <iostream>
+
+#include "GulgEngine/GulgDeclarations.hpp"
+#include "GulgEngine/Signature.hpp"
+#include "GulgEngine/ComponentAllocator.hpp"
+#include "Components/Component.hpp"
+#include "Components/ComponentTypes.hpp"
+
+namespace Gg {
+
+// Template of an entity, registered once in the engine (GulgEngine::addPrefab).
+// Every instance gets a copy of each prototype, made through the copy constructor of its type.
+
+class Prefab {
+
+	public:
+
+		Prefab();
+
+		template<typename T>
+		void addComponent(std::shared_ptr<T> prototype) { addComponentAs<T>(std::move(prototype)); }
+
+		// Stored as a Stored, a base of T, while instances still get copies of the whole T
+		template<typename Stored, typename T>
+		void addComponentAs(std::shared_ptr<T> prototype) {
+
+			static_assert(std::is_base_of<Stored, T>::value, "A prefab component can only be stored as one of its bases.");
+			addComponent(Component::ComponentType<Stored>::id, std::move(prototype), &copyComponent<T>);
+		}
+
+		size_t getNbComponents() const;
+		ComponentID getComponentID(const size_t component) const;
+		std::shared_ptr<Component::AbstractComponent> copyComponent(const size_t component) const;
+
+		void setSignature(const Signature &signature);
+		const Signature &getSignature() const;
+
+	private:
+
+		using CopyFunction = std::shared_ptr<Component::AbstractComponent> (*)(const Component::AbstractComponent &);
+
+		template<typename T>
+		static std::shared_ptr<Component::AbstractComponent> copyComponent(const Component::AbstractComponent &prototype) {
+
+			return makeComponent<T>(static_cast<const T&>(prototype));
+		}
+
+		void addComponent(const ComponentID id, std::shared_ptr<Component::AbstractComponent> prototype, CopyFunction copy);
+
+		struct Element {
+
+			ComponentID id;
+			std::shared_ptr<Component::AbstractComponent> prototype;
+			CopyFunction copy;
+		};
+
+		std::vector<Element> m_elements;
+		Signature m_signature;
+};
+
+// Components of instances not yet added to the engine, entity after entity in the order of the prefab.
+
+struct PrefabBatch {
+
+	PrefabBatch(const Prefab &batchPrefab, std::vector<Entity> batchEntities);
+
+	const Prefab *prefab;
+	std::vector<Entity> entities;
+	std::vector<std::shared_ptr<Component::AbstractComponent>> components;
+};
+
+// Given to the init function of an instantiation, to set up one instance before it is added.
+
+class PrefabInstance {
+
+	public:
+
+		PrefabInstance(PrefabBatch &batch, const size_t index);
+
+		size_t getIndex() const;
+		Entity getEntity() const;
+
+		template<typename T>
+		T &get() const { return static_cast<T&>(*getComponent(Component::ComponentType<T>::id)); }
+
+		template<typename T>
+		std::shared_ptr<T> getPointer() const { return std::static_pointer_cast<T>(getComponent(Component::ComponentType<T>::id)); }
+
+		// Same check as GulgEngine::getComponentAs, throws if the component stored as a Stored isn't a T
+		template<typename Stored, typename T>
+		T &getAs() const {
+
+			T *component{dynamic_cast<T*>(getComponent(Component::ComponentType<Stored>::id).get())};
+			if(component == nullptr) { throw std::runtime_error("Gulg error: component " + std::string{Component::ComponentType<Stored>::name} + " of a prefab instance isn't of the asked type."); }
+
+			return *component;
+		}
+
+	private:
+
+		const std::shared_ptr<Component::AbstractComponent> &getComponent(const ComponentID id) const;
+
+		PrefabBatch &m_batch;
+		const size_t m_index;
+};
+
+using PrefabInit = std::function<void(PrefabInstance &instance)>;
+
+// Copies the prototypes for every entity and calls init on each instance.
+PrefabBatch makePrefabBatch(const Prefab &prefab, std::vector<Entity> entities, const PrefabInit &init);
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef SCENE_GRAPH_HPP
+#define SCENE_GRAPH_HPP
+
+#include <stdexcept>
+#include <vector>
+#include <limits>
+
+#include "GulgEngine/GulgDeclarations.hpp"
+
+namespace Gg {
+
+// Parent/child links between entities. Nodes are indexed by entity index and keep intrusive
+// sibling links, so attaching or detaching a node is O(1).
+// getOrder() gives the nodes flattened in depth first order: every parent comes before its
+// children, and getParentIndices()[i] is the position of the parent of getOrder()[i] (or NoParent).
+// The flattened arrays are only rebuilt after the hierarchy changed, and the nodes attached or
+// given another parent since are kept, so users caching data per node can only update those.
+
+class SceneGraph {
+
+	public:
+
+		static constexpr unsigned int NoParent{std::numeric_limits<unsigned int>::max()};
+
+		SceneGraph();
+
+		void addRoot(const Entity entity);
+		void setParent(const Entity child, const Entity parent);
+		void remove(const Entity entity);
+
+		bool contains(const Entity entity) const;
+		Entity getParent(const Entity entity) const;
+		std::vector<Entity> getChildren(const Entity entity) const;
+
+		const std::vector<Entity> &getOrder();
+		const std::vector<unsigned int> &getParentIndices();
+
+		// Nodes attached or given another parent since the last call, each one once. Their
+		// descendants moved with them but aren't in the list.
+		std::vector<Entity> takeMovedNodes();
+
+	private:
+
+		struct Node {
+
+			Entity entity{NoEntity};
+			Entity parent{NoEntity};
+			Entity firstChild{NoEntity};
+			Entity previousSibling{NoEntity};
+			Entity nextSibling{NoEntity};
+			bool hasMoved{false};
+		};
+
+		Node &getNode(const Entity entity);
+		const Node &getNode(const Entity entity) const;
+		Node &insertNode(const Entity entity);
+
+		void link(const Entity entity, const Entity parent);
+		void unlink(const Entity entity);
+		void flatten();
+
+		std::vector<Node> m_nodes;
+		Entity m_firstRoot;
+
+		std::vector<Entity> m_order;
+		std::vector<unsigned int> m_parentIndices;
+		std::vector<std::pair<Entity, unsigned int>> m_stack;
+		std::vector<Entity> m_movedNodes;
+		bool m_isFlat;
+};
+
+}
+
+#endif
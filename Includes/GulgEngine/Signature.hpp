@@ -2,14 +2,30 @@
 #define SIGNATURE_HPP
 
 #include <vector>
+#include <array>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
 #include <iostream>
 
 namespace Gg {
 
+// Bits are packed in 64 bits words. The first InlineBits bits live inside the object,
+// so copying a signature of up to 256 components never allocates.
+// Bits beyond getSignatureSize() are always kept to 0, which makes every operation
+// a plain word loop with no size check.
+
 class Signature {
 
 	public:
 
+		using Word = std::uint64_t;
+
+		static constexpr size_t WordBits{64};
+		static constexpr size_t InlineWords{4};
+		static constexpr size_t InlineBits{InlineWords*WordBits};
+
 		Signature();
 		Signature(const size_t signatureSize);
 		Signature(const std::vector<bool> sign);
@@ -33,7 +49,11 @@ class Signature {
 		Signature operator&(const Signature &second) const;
 		void operator&=(const Signature &second);
 
+		bool contains(const Signature &second) const;
+		bool intersects(const Signature &second) const;
+
 		void changeBit(const size_t bit, const bool value);
+		bool getBit(const size_t bit) const;
 
 		std::string asString() const;
 
@@ -41,11 +61,18 @@ class Signature {
 
 	private:
 
-		std::vector<bool> m_signature;                  
+		void resize(const size_t signatureSize);
+
+		Word getWord(const size_t word) const;
+		Word &getWord(const size_t word);
+
+		std::array<Word, InlineWords> m_words;
+		std::vector<Word> m_extraWords;
+		size_t m_size;
 };
 
 std::ostream& operator<<(std::ostream &stream, const Signature &sign);
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -3,6 +3,8 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <stdexcept>
 #include <fstream>
 
 #include "GulgEngine/Signature.hpp"
@@ -20,13 +22,17 @@ class SignatureLoader {
 
 		bool existingName(const std::string name) const;
 
-		Signature getSignature(const std::string name) const;
+		const Signature &getSignature(const std::string name) const;
+		ComponentID getComponentID(const std::string name) const;
+		const Signature &getSignatureFromID(const ComponentID id) const;
 
 		size_t getNumberOfSignatures() const;
 
 	private:
 
-		std::map<std::string, Signature> m_signatures;               
+		std::map<std::string, Signature> m_signatures;
+		std::map<std::string, ComponentID> m_componentIDs;
+		std::vector<Signature> m_signaturesByID;
 };
 
 }
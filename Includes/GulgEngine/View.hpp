@@ -0,0 +1,126 @@
+#ifndef VIEW_HPP
+#define VIEW_HPP
+
+#include <array>
+#include <tuple>
+#include <vector>
+#include <utility>
+
+#include "GulgEngine/GulgDeclarations.hpp"
+#include "GulgEngine/ComponentPool.hpp"
+
+namespace Gg {
+
+// Every entity owning all the components Ts, given with references on them.
+// The smallest pool drives the iteration: its components are read at their dense index,
+// the others pools are only asked through their entity->slot index.
+// Adding or removing one of the Ts while iterating invalidates the view.
+
+template<typename... Ts>
+class View {
+
+	public:
+
+		static constexpr size_t NbPools{sizeof...(Ts)};
+
+		class Iterator {
+
+			public:
+
+				Iterator(const View &view, const size_t index): m_view{view}, m_index{index} { skipInvalid(); }
+
+				std::tuple<Entity, Ts&...> operator*() const { return m_view.getAt(m_index, std::index_sequence_for<Ts...>{}); }
+
+				Iterator &operator++() {
+
+					++m_index;
+					skipInvalid();
+					return *this;
+				}
+
+				bool operator!=(const Iterator &second) const { return m_index != second.m_index; }
+
+			private:
+
+				void skipInvalid() {
+
+					const std::vector<Entity> &entities{m_view.m_driver->getEntities()};
+					while(m_index < entities.size() && !m_view.contains(entities[m_index])) { ++m_index; }
+				}
+
+				const View &m_view;
+				size_t m_index;
+		};
+
+		View(const std::array<const ComponentPool*, NbPools> pools): m_pools{pools}, m_driver{pools[0]} {
+
+			for(const ComponentPool *currentPool: m_pools) {
+
+				if(currentPool->size() < m_driver->size()) { m_driver = currentPool; }
+			}
+		}
+
+		template<typename Function>
+		void each(Function function) const { each(0, getNbSlots(), function); }
+
+		// Only the slots [begin, end) of the driving pool, so disjoint ranges can be run by different jobs
+		template<typename Function>
+		void each(const size_t begin, const size_t end, Function function) const {
+
+			const std::vector<Entity> &entities{m_driver->getEntities()};
+
+			for(size_t i{begin}; i < end && i < entities.size(); i++) {
+
+				if(contains(entities[i])) { std::apply(function, getAt(i, std::index_sequence_for<Ts...>{})); }
+			}
+		}
+
+		// Slots of the driving pool, an upper bound of the number of entities of the view
+		size_t getNbSlots() const { return m_driver->size(); }
+
+		Iterator begin() const { return Iterator{*this, 0}; }
+		Iterator end() const { return Iterator{*this, m_driver->size()}; }
+
+		bool contains(const Entity entity) const {
+
+			for(const ComponentPool *currentPool: m_pools) {
+
+				if(currentPool != m_driver && !currentPool->has(entity)) { return false; }
+			}
+
+			return m_driver->has(entity);
+		}
+
+		std::tuple<Ts&...> get(const Entity entity) const { return getFor(entity, std::index_sequence_for<Ts...>{}); }
+
+	private:
+
+		template<size_t... Is>
+		std::tuple<Entity, Ts&...> getAt(const size_t index, std::index_sequence<Is...>) const {
+
+			const Entity entity{m_driver->getEntities()[index]};
+			return std::tuple<Entity, Ts&...>{entity, fetch<Is>(entity, index)...};
+		}
+
+		template<size_t... Is>
+		std::tuple<Ts&...> getFor(const Entity entity, std::index_sequence<Is...>) const {
+
+			return std::tuple<Ts&...>{static_cast<std::tuple_element_t<Is, std::tuple<Ts...>>&>(*m_pools[Is]->get(entity))...};
+		}
+
+		template<size_t I>
+		std::tuple_element_t<I, std::tuple<Ts...>> &fetch(const Entity entity, const size_t index) const {
+
+			const ComponentPool *pool{m_pools[I]};
+			Component::AbstractComponent &component{pool == m_driver ? *pool->getComponents()[index] : *pool->get(entity)};
+
+			return static_cast<std::tuple_element_t<I, std::tuple<Ts...>>&>(component);
+		}
+
+		std::array<const ComponentPool*, NbPools> m_pools;
+		const ComponentPool *m_driver;
+};
+
+}
+
+#endif
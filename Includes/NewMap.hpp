@@ -9,23 +9,47 @@
 #include "GulgEngine/GulgEngine.hpp"
 
 #include "Components/Mesh.hpp"
+#include "Components/VoxelMesh.hpp"
+#include "Components/LevelOfDetail.hpp"
 #include "Components/Transformation.hpp"
 #include "Components/SceneObject.hpp"
 #include "Components/VoxelMap.hpp"
+#include "Components/VoxelFaceCulling.hpp"
 
 std::vector<glm::vec3> generateWorld(VoxelMap &currentMap, const unsigned int interpolationFrequency);
 
-std::vector<std::pair<unsigned int, glm::vec3>> voxelsAndOrientations(const unsigned int voxelMapSize);
+std::vector<glm::vec3> getFaceFromOrientation(const glm::vec3 &position, const glm::vec3 &orientation);
 
-std::vector<std::pair<unsigned int, glm::vec3>> selectVisibleFaces(const VoxelMap &map, const std::vector<std::pair<unsigned int, glm::vec3>> &facesToSelect);
+void localRemeshing(const std::vector<unsigned int> &voxels, VoxelMap &map, const unsigned int chunk, Gg::Component::VoxelMesh &mesh);
 
-std::vector<glm::vec3> getFaceFromOrientation(const glm::vec3 &position, const glm::vec3 &orientation);
+void worldMapToMesh(VoxelMap &map, const unsigned int chunk, Gg::Component::VoxelMesh &mesh);
+
+// Merges the coplanar visible faces of the same color into rectangles
+void greedyWorldMapToMesh(VoxelMap &map, const unsigned int chunk, Gg::Component::VoxelMesh &mesh);
+
+// Mesh of the chunk with 2^level voxels merged along each axis. A merged voxel is solid when at
+// least half of its voxels inside of the world are, and takes their most common color.
+void levelOfDetailToMesh(const VoxelMap &map, const unsigned int chunk, const unsigned int level, Gg::Component::VoxelMesh &mesh);
+
+// Sizes of the remeshed chunk meshes before and after remeshing
+struct VoxelMeshStatistics {
+
+	unsigned int nbRemeshedChunks;
+	size_t nbVerticesBefore, nbVerticesAfter;
+	size_t nbIndicesBefore, nbIndicesAfter;
+};
 
-void localRemeshing(std::vector<std::vector<unsigned int>> v,VoxelMap &map, Gg::Component::Mesh &mesh);
+// Meshes the chunks concurrently, each one into its own mesh, with the meshing of the chunk.
+// Culled chunks remeshed voxel by voxel are meshed whole again once too many of their faces are free.
+// Meshes are only uploaded when drawn, by the thread owning the GL context. The result doesn't
+// depend on the number of workers.
+VoxelMeshStatistics meshChunks(Gg::JobSystem &jobSystem, VoxelMap &map, const std::vector<std::pair<unsigned int, Gg::Component::VoxelMesh*>> &chunks);
 
-void worldMapToMesh(VoxelMap &map, Gg::Component::Mesh &mesh);
+// Remeshes the dirty chunks into the meshes of their entities
+VoxelMeshStatistics remeshVoxelMap(Gg::GulgEngine &engine, VoxelMap &map);
 
-void Cube(std::shared_ptr<Gg::Component::Mesh> mesh , float size,glm::vec3 color);
+// Unit cube centered on the origin
+void Cube(std::shared_ptr<Gg::Component::VoxelMesh> mesh, glm::vec3 color);
 
 std::vector<FMOD::Studio::EventInstance*> generateBirds(std::vector<glm::vec3> birdPosition, FMOD::Studio::EventDescription *birdDescription);
 
@@ -4,6 +4,7 @@
 #include "Systems/System.hpp"
 
 #include "Algorithms/DrawMesh.hpp"
+#include "Algorithms/UpdateLevelOfDetail.hpp"
 
 class DrawScene: public Gg::Systems::System {
 
@@ -16,8 +17,15 @@ class DrawScene: public Gg::Systems::System {
 		void setCameraEntity(const Gg::Entity camera);
 		void setProjection(const glm::mat4 projection);
 
+		// Mesh bytes sent to the GPU by the last frame
+		size_t getUploadedBytes() const;
+
+		const LevelOfDetailStatistics &getLevelOfDetailStatistics() const;
+
 	private:
 
+		Gg::Algorithm::UpdateLevelOfDetail *m_updateLevelOfDetail;
+		Gg::Algorithm::DrawMesh *m_drawMesh;
 		Gg::Entity m_cameraEntity;
 		glm::mat4 m_projectionMatrix;
 };
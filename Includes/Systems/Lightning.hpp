@@ -13,21 +13,12 @@ class Lightning: public Gg::Systems::System {
 		
 		virtual ~Lightning();
 
-		virtual void addEntity(const Gg::Entity newEntity);
-		virtual void deleteEntity(const Gg::Entity newEntity);
-
-		virtual void applyAlgorithms();
-
 		unsigned int getNbMaxLight() const;
 		unsigned int getCurrentNbLight() const;
 
 	private:
 
 		const unsigned int m_nbMaxLight;
-		unsigned int m_currentNbLight;
-
-		const GLuint m_program;
-		const GLint m_nbLightID;
 };
 
 
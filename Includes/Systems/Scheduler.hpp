@@ -0,0 +1,65 @@
+#ifndef SCHEDULER_HPP
+#define SCHEDULER_HPP
+
+#include <vector>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+
+#include "GulgEngine/JobSystem.hpp"
+
+#include "Systems/System.hpp"
+
+namespace Gg {
+
+namespace Systems {
+
+// Runs the algorithms of the added systems once per frame.
+// Between two sync points, an algorithm only waits for the previously added ones it conflicts with
+// (see AbstractAlgorithm::conflictsWith), for the previous algorithm of its own system and,
+// for main thread only algorithms, for the previous main thread only ones.
+// Independent algorithms run concurrently on the job system, main thread only ones on the calling thread.
+// Sync points run on the calling thread once everything added before them is done.
+
+class Scheduler {
+
+	public:
+
+		Scheduler(JobSystem &jobSystem);
+
+		void addSystem(System &system);
+		void addSyncPoint(std::function<void()> syncPoint);
+
+		void run();
+
+	private:
+
+		struct Step {
+
+			System *system;
+			std::function<void()> syncPoint;
+		};
+
+		struct Task {
+
+			Algorithm::AbstractAlgorithm *algorithm;
+			std::vector<size_t> successors;
+			size_t nbDependencies;
+		};
+
+		void runTasks(std::vector<Task> &tasks);
+		void finishTask(std::vector<Task> &tasks, const size_t task);
+		void launchTask(std::vector<Task> &tasks, const size_t task);
+
+		JobSystem &m_jobSystem;
+		std::vector<Step> m_steps;
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::vector<size_t> m_mainThreadTasks;
+		size_t m_nbFinishedTasks;
+};
+
+}}
+
+#endif
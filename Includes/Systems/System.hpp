@@ -25,8 +25,12 @@ class System {
 
 		virtual void applyAlgorithms();
 
+		const std::vector<std::unique_ptr<Algorithm::AbstractAlgorithm>> &getAlgorithms() const;
+
 	protected:
 
+		void addAlgorithm(std::unique_ptr<Algorithm::AbstractAlgorithm> algorithm);
+
 		std::vector<std::unique_ptr<Algorithm::AbstractAlgorithm>> m_algorithms;
 		GulgEngine &m_gulgEngine;      
 };
@@ -0,0 +1,25 @@
+#ifndef TERRAIN_SYSTEM_HPP
+#define TERRAIN_SYSTEM_HPP
+
+#include "Systems/System.hpp"
+
+#include "Algorithms/UpdateVoxelMeshes.hpp"
+
+class Terrain: public Gg::Systems::System {
+
+	public:
+
+		Terrain(Gg::GulgEngine &gulgEngine);
+
+		virtual ~Terrain();
+
+		unsigned int getNbRemeshedChunks() const;
+		const VoxelMeshStatistics &getMeshStatistics() const;
+
+	private:
+
+		Gg::Algorithm::UpdateVoxelMeshes *m_updateVoxelMeshes;
+};
+
+
+#endif
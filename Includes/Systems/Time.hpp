@@ -15,8 +15,6 @@ class Time: public Gg::Systems::System {
 		Gg::Entity &world;
 		FMOD::Studio::EventDescription *explosioneventDescription;
 
-		std::vector<Gg::Entity> toDelete;
-		std::vector<Gg::Entity> toAdd;
 
 };
 
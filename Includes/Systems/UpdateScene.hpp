@@ -12,6 +12,12 @@ class UpdateScene: public Gg::Systems::System {
 		UpdateScene(Gg::GulgEngine &gulgEngine);
 		
 		virtual ~UpdateScene();
+
+		size_t getNbUpdatedNodes() const;
+
+	private:
+
+		Gg::Algorithm::UpdateTransformations *m_updateTransformations;
 };
 
 
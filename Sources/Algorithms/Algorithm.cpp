@@ -4,22 +4,56 @@ namespace Gg {
 
 namespace Algorithm {
 
-AbstractAlgorithm::AbstractAlgorithm(GulgEngine &gulgEngine): m_gulgEngine{gulgEngine} {}
+AbstractAlgorithm::AbstractAlgorithm(GulgEngine &gulgEngine): m_gulgEngine{gulgEngine}, m_subscribeToEngine{true}, m_mainThreadOnly{false}, m_isSubscribed{false} {}
 
-AbstractAlgorithm::~AbstractAlgorithm() {}
+AbstractAlgorithm::~AbstractAlgorithm() {
+
+	if(m_isSubscribed) { m_gulgEngine.unsubscribeQuery(m_entitiesToApply); }
+}
 
 void AbstractAlgorithm::addEntity(const Entity newEntity) { 
 
-	std::vector<Entity>::iterator it{std::find(m_entitiesToApply.begin(), m_entitiesToApply.end(), newEntity)};
-	if(it == m_entitiesToApply.end()) { m_entitiesToApply.emplace_back(newEntity); }
+	if(!m_isSubscribed) { m_entitiesToApply.add(newEntity); }
 }
 
 void AbstractAlgorithm::deleteEntity(const Entity entity) {
 
-	std::vector<Entity>::iterator it{std::find(m_entitiesToApply.begin(), m_entitiesToApply.end(), entity)};
-	if(it != m_entitiesToApply.end()) { m_entitiesToApply.erase(it); }
+	if(!m_isSubscribed) { m_entitiesToApply.remove(entity); }
+}
+
+void AbstractAlgorithm::subscribe() {
+
+	m_entitiesToApply.setSignature(m_signature);
+	m_gulgEngine.subscribeQuery(m_entitiesToApply);
+	m_isSubscribed = true;
+}
+
+bool AbstractAlgorithm::isSubscribed() const { return m_isSubscribed; }
+
+bool AbstractAlgorithm::wantsSubscription() const { return m_subscribeToEngine; }
+
+const Signature &AbstractAlgorithm::getSignature() const { return m_signature; }
+
+const EntityQuery &AbstractAlgorithm::getEntities() const { return m_entitiesToApply; }
+
+const Signature &AbstractAlgorithm::getReadSignature() const { return m_readSignature; }
+
+const Signature &AbstractAlgorithm::getWriteSignature() const { return m_writeSignature; }
+
+bool AbstractAlgorithm::isMainThreadOnly() const { return m_mainThreadOnly; }
+
+bool AbstractAlgorithm::conflictsWith(const AbstractAlgorithm &other) const {
+
+	if(!declaresAccess() || !other.declaresAccess()) { return true; }
+
+	return m_writeSignature.intersects(other.m_readSignature)
+		|| m_writeSignature.intersects(other.m_writeSignature)
+		|| other.m_writeSignature.intersects(m_readSignature);
 }
 
-Signature AbstractAlgorithm::getSignature() const { return m_signature; }
+bool AbstractAlgorithm::declaresAccess() const {
+
+	return !(m_readSignature == Signature{}) || !(m_writeSignature == Signature{});
+}
 
-}}
\ No newline at end of file
+}}
@@ -9,10 +9,13 @@ namespace Gg {
     CollisionsResolution::CollisionsResolution(Gg::GulgEngine &gulgEngine,Gg::Entity &w, Collisions* c):
       AbstractAlgorithm{gulgEngine},world{w},collisions(c) {
 
-      m_signature = gulgEngine.getComponentSignature("SceneObject");
-      m_signature += gulgEngine.getComponentSignature("Transformations");
-      m_signature += gulgEngine.getComponentSignature("Collider");
-      m_signature += gulgEngine.getComponentSignature("Forces");
+      m_signature = gulgEngine.getComponentSignature<Gg::Component::SceneObject>();
+      m_signature += gulgEngine.getComponentSignature<Gg::Component::Transformation>();
+      m_signature += gulgEngine.getComponentSignature<Gg::Component::Collider>();
+      m_signature += gulgEngine.getComponentSignature<Gg::Component::Forces>();
+
+      reads<Gg::Component::SceneObject, Gg::Component::Collider, Gg::Component::Explosive, Gg::Component::StepSound>();
+      writes<Gg::Component::Forces, VoxelMap>();
 
     }
     CollisionsResolution::~CollisionsResolution() {
@@ -32,100 +35,42 @@ namespace Gg {
       return result;
     }
     void CollisionsResolution::apply() {
-      bool explode{false};
-      glm::mat4 wT{std::static_pointer_cast<Gg::Component::SceneObject>(m_gulgEngine.getComponent(world, "SceneObject"))->m_globalTransformations};
-      std::shared_ptr<VoxelMap> vM{
-        std::static_pointer_cast<VoxelMap>(m_gulgEngine.getComponent(world, "VoxelMap"))
-      };
+      glm::mat4 wT{m_gulgEngine.getComponent<Gg::Component::SceneObject>(world).m_globalTransformations};
+      VoxelMap &vM{m_gulgEngine.getComponent<VoxelMap>(world)};
        std::vector<std::vector<unsigned int>> vxsToRs;
-      //For each entity :
-    	for(unsigned int i{0};i<collisions->entity_world_collisions.size();i++) {
-        std::pair<Gg::Entity,std::vector<int>> currentEntity = collisions->entity_world_collisions[i];
-        glm::mat4 eT{std::static_pointer_cast<Gg::Component::SceneObject>(m_gulgEngine.getComponent(currentEntity.first, "SceneObject"))->m_globalTransformations};
+      Gg::View<Gg::Component::SceneObject, Gg::Component::Collider, Gg::Component::Forces> colliders{
+        m_gulgEngine.view<Gg::Component::SceneObject, Gg::Component::Collider, Gg::Component::Forces>()
+      };
+      auto explodesOnContact = [this](const std::pair<Gg::Entity,std::vector<int>> &currentEntity) {
+        return currentEntity.second.size()>0 && m_gulgEngine.entityHasComponent<Gg::Component::Explosive>(currentEntity.first)
+          && m_gulgEngine.getComponent<Gg::Component::Explosive>(currentEntity.first).eTrigger == ON_COLLISION;
+      };
+      //Contacts only change the forces of their own entity, they are solved in parallel on the map of the detection
+      parallelFor(collisions->entity_world_collisions, 32, [&](const std::pair<Gg::Entity,std::vector<int>> &currentEntity) {
+        if(explodesOnContact(currentEntity)) return;
+        auto [eScene, eCollider, eForces] = colliders.get(currentEntity.first);
+        glm::mat4 eT{eScene.m_globalTransformations};
         glm::vec3 ePosition{
           eT[3][0],eT[3][1],eT[3][2]
         };
-         std::shared_ptr<Gg::Component::Collider> eCollider {
-           std::static_pointer_cast<Gg::Component::Collider>(m_gulgEngine.getComponent(currentEntity.first, "Collider"))
-         };
-         std::shared_ptr<Gg::Component::Forces> eForces {
-           std::static_pointer_cast<Gg::Component::Forces>(m_gulgEngine.getComponent(currentEntity.first, "Forces"))
-         };
          std::vector<int> voxelToCheck {currentEntity.second};
 
          ePosition -= 0.5f;
-         if(voxelToCheck.size()>0 && m_gulgEngine.entityHasComponent(currentEntity.first,"Explosive")
-         && std::static_pointer_cast<Gg::Component::Explosive>(m_gulgEngine.getComponent(currentEntity.first, "Explosive"))->eTrigger == ON_COLLISION ){
-            vxsToRs.push_back(vM->explode(-1.f*ePosition[0],-1.f*ePosition[1],-1.f*ePosition[2],std::static_pointer_cast<Gg::Component::Explosive>(m_gulgEngine.getComponent(currentEntity.first, "Explosive"))->explosivePower));
-            std::vector<unsigned int> vv{vxsToRs[vxsToRs.size()-1]};
-           collisions->toDelete.push_back(currentEntity.first);
-           explode=true;
-           float x { -1.f*ePosition[0]}, y {-1.f*ePosition[1]}, z {-1.f*ePosition[2]};
-           float eP = std::static_pointer_cast<Gg::Component::Explosive>(m_gulgEngine.getComponent(currentEntity.first, "Explosive"))->explosivePower;
-           for(unsigned int j{0};j<vv.size();j++){
-             glm::vec3 vP {vM->getVoxelPosition(vv[j])};
-             vP+=0.5f;
-             if(vM->getColor(vv[j])[3] != 0.f && (eP*eP) >=  (x-vP[0])*(x-vP[0])+(y-vP[1])*(y-vP[1])+(z-vP[2])*(z-vP[2]) ){
-               Gg::Entity newG{m_gulgEngine.getNewEntity()};
-               std::shared_ptr<Gg::Component::SceneObject> newGScene{std::make_shared<Gg::Component::SceneObject>()};
-               std::shared_ptr<Gg::Component::Transformation> newGTransformation{std::make_shared<Gg::Component::Transformation>()};
-               std::shared_ptr<Gg::Component::Collider> newGCollider{std::make_shared<Gg::Component::Collider>()};
-               std::shared_ptr<Gg::Component::Forces> newGForces{std::make_shared<Gg::Component::Forces>(glm::vec3{0.f},0.1f,1.f,2.f)};
-               std::shared_ptr<Gg::Component::Mesh> newGMesh{std::make_shared<Gg::Component::Mesh>(m_gulgEngine.getProgram("MainProgram"))};
-               std::shared_ptr<Gg::Component::Timer> newGTimer{std::make_shared<Gg::Component::Timer>(5000)};
-
-               Cube(newGMesh,0.5f,vM->getColor(vv[j]));
-               vP*=-1.f;
-               newGTransformation->translate(vP);
-               glm::vec3 f{vP - ePosition  };
-               f=glm::normalize(f);
-               if(f[2]>0.f)f[2] = -f[2];
-               newGForces->addForce(f*(eP/2.f));
-               m_gulgEngine.addComponentToEntity(newG, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGScene));
-               m_gulgEngine.addComponentToEntity(newG, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGTransformation));
-               m_gulgEngine.addComponentToEntity(newG, "Collider", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGCollider));
-               m_gulgEngine.addComponentToEntity(newG, "Forces", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGForces));
-               m_gulgEngine.addComponentToEntity(newG, "MainMesh", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGMesh));
-               m_gulgEngine.addComponentToEntity(newG, "Timer", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGTimer));
-               collisions->toAdd.push_back(newG);
-
-             }
-           }
-
-           FMOD_RESULT fmodResult;
-           FMOD::Studio::EventInstance *explosioneventInstance{nullptr};
-           fmodResult = collisions->explosioneventDescription->createInstance(&explosioneventInstance);
-
-            if (fmodResult != FMOD_OK) {
-
-               std::cout << "Error " << fmodResult << " with FMOD studio API event creation: " << FMOD_ErrorString(fmodResult) << std::endl;
-           }
-           FMOD_3D_ATTRIBUTES att3D{
-             FMOD_VECTOR{ eT[3][0],eT[3][1],eT[3][2]},
-             FMOD_VECTOR{0.f,0.f,0.f },
-             FMOD_VECTOR{ 0.f,-1.f,0.f},
-             FMOD_VECTOR{0.f,0.f,-1.f}};
-           explosioneventInstance->set3DAttributes(&att3D);
-           explosioneventInstance->setVolume(0.4f);
-           explosioneventInstance->start();
-           explosioneventInstance->release();
-
-         }else{
            // std::cout<<voxelToCheck.size()<<std::endl;
-           glm::vec3 bbmin{  ePosition + eCollider->bbmin};
-           glm::vec3 bbmax{ePosition + eCollider->bbmax  };
+           glm::vec3 bbmin{  ePosition + eCollider.bbmin};
+           glm::vec3 bbmax{ePosition + eCollider.bbmax  };
 
-           bbmin -= (eForces->forces + eForces->velocity);
-           bbmax -= (eForces->forces + eForces->velocity);
+           bbmin -= (eForces.forces + eForces.velocity);
+           bbmax -= (eForces.forces + eForces.velocity);
            // std::cout<<to_string(bbmin)<<std::endl<<to_string(bbmax)<<std::endl;
 
            glm::vec3 collisional_response{0.f,0.f,0.f};
            glm::vec3 vcolor{0.f,0.f,0.f};
            for(unsigned int j{0};j<voxelToCheck.size();j++){
-              glm::vec3 posV = vM->getVoxelPosition(voxelToCheck[j]);
+              glm::vec3 posV = vM.getVoxelPosition(voxelToCheck[j]);
               glm::vec3 brV = -1.f *  (posV+0.5f);
               glm::vec3 brE {getClosestPoint(brV,bbmin,bbmax)};
-              // glm::vec3 brE{ePosition + eCollider->r};
+              // glm::vec3 brE{ePosition + eCollider.r};
 
               glm::vec3 df {brE-brV};
               if(std::abs(df[0])> std::abs(df[1]) && std::abs(df[0])> std::abs(df[2]) ){
@@ -142,39 +87,37 @@ namespace Gg {
               glm::vec3 v{posV -df};
 
 
-              if( glm::dot(df,(eForces->velocity+eForces->forces))<=0.f
+              if( glm::dot(df,(eForces.velocity+eForces.forces))<=0.f
                   && v[0]>=0.f && v[1]>=0.f && v[2]>=0.f
-                  && v[0] < vM->getWorldDimensions()[0] && v[1] < vM->getWorldDimensions()[1]&& v[2] < vM->getWorldDimensions()[2]
-                  && vM->getColor(v[0],v[1],v[2])[3]<0.2f
+                  && v[0] < vM.getWorldDimensions()[0] && v[1] < vM.getWorldDimensions()[1]&& v[2] < vM.getWorldDimensions()[2]
+                  && !vM.isSolid(v[0],v[1],v[2])
                 ){
                 for(unsigned int k{0};k<3;k++){
                   if(df[k]!=0.f ){
-                      collisional_response[k] = (eForces->velocity[k]+eForces->forces[k]);
+                      collisional_response[k] = (eForces.velocity[k]+eForces.forces[k]);
                       k=3;
                     }
                   }
                 }
                 if(df[2]==-1.f){
-                  vcolor = vM->getColor(voxelToCheck[j]);
+                  vcolor = vM.getColor(voxelToCheck[j]);
                 }
               }
               if(voxelToCheck.size()>0 && glm::length(collisional_response)==0.f){
-                collisional_response[2] = (eForces->velocity[2]+eForces->forces[2]);
+                collisional_response[2] = (eForces.velocity[2]+eForces.forces[2]);
               }
-              glm::vec3 soundTest {eForces->velocity+eForces->forces}; soundTest[2]=0.f;
+              glm::vec3 soundTest {eForces.velocity+eForces.forces}; soundTest[2]=0.f;
               if(collisional_response[2] != 0
                 && glm::length(soundTest) > 0.1f
-                && m_gulgEngine.entityHasComponent(currentEntity.first,"StepSound")
+                && m_gulgEngine.entityHasComponent<Gg::Component::StepSound>(currentEntity.first)
               ){
-                std::shared_ptr<Gg::Component::StepSound> sS {
-                  std::static_pointer_cast<Gg::Component::StepSound>(m_gulgEngine.getComponent(currentEntity.first, "StepSound"))
-                };
+                Gg::Component::StepSound &sS{m_gulgEngine.getComponent<Gg::Component::StepSound>(currentEntity.first)};
                 FMOD_RESULT fmodResult;
 
                 if(vcolor[0]<0.4f){
-                  fmodResult = sS->stepeventInstance->setParameterByName("Matiere", 0);
+                  fmodResult = sS.stepeventInstance->setParameterByName("Matiere", 0);
                 }else{
-                  fmodResult = sS->stepeventInstance->setParameterByName("Matiere", 1);
+                  fmodResult = sS.stepeventInstance->setParameterByName("Matiere", 1);
                 }
                 if (fmodResult != FMOD_OK) {
                    std::cout << "Error " << fmodResult << " with FMOD studio API parameter: " << FMOD_ErrorString(fmodResult) << std::endl;
@@ -184,24 +127,72 @@ namespace Gg {
                   FMOD_VECTOR{0.f,0.f,0.f },
                   FMOD_VECTOR{ 0.f,-1.f,0.f},
                   FMOD_VECTOR{0.f,0.f,-1.f}};
-                sS->stepeventInstance->set3DAttributes(&att3D);
+                sS.stepeventInstance->set3DAttributes(&att3D);
                 FMOD_STUDIO_PLAYBACK_STATE s;
-                sS->stepeventInstance->getPlaybackState(&s);
-                if(s != FMOD_STUDIO_PLAYBACK_PLAYING )sS->stepeventInstance->start();
-                sS->stepeventInstance->setVolume(glm::length(eForces->velocity)/4.f);
+                sS.stepeventInstance->getPlaybackState(&s);
+                if(s != FMOD_STUDIO_PLAYBACK_PLAYING )sS.stepeventInstance->start();
+                sS.stepeventInstance->setVolume(glm::length(eForces.velocity)/4.f);
               }
-              eForces->addForce(-collisional_response );
-              eForces->velocity/=1.1f;
+              eForces.addForce(-collisional_response );
+              eForces.velocity/=1.1f;
 
-          }
+      });
+      //Explosions change the map, one after the other
+    	for(unsigned int i{0};i<collisions->entity_world_collisions.size();i++) {
+        const std::pair<Gg::Entity,std::vector<int>> &currentEntity = collisions->entity_world_collisions[i];
+        if(!explodesOnContact(currentEntity)) continue;
+        Gg::Component::SceneObject &eScene{std::get<0>(colliders.get(currentEntity.first))};
+        glm::mat4 eT{eScene.m_globalTransformations};
+        glm::vec3 ePosition{
+          eT[3][0],eT[3][1],eT[3][2]
+        };
+         ePosition -= 0.5f;
+            vxsToRs.push_back(vM.explode(-1.f*ePosition[0],-1.f*ePosition[1],-1.f*ePosition[2],m_gulgEngine.getComponent<Gg::Component::Explosive>(currentEntity.first).explosivePower));
+            std::vector<unsigned int> vv{vxsToRs[vxsToRs.size()-1]};
+           m_gulgEngine.getCommandBuffer().deleteEntity(currentEntity.first);
+           float x { -1.f*ePosition[0]}, y {-1.f*ePosition[1]}, z {-1.f*ePosition[2]};
+           float eP = m_gulgEngine.getComponent<Gg::Component::Explosive>(currentEntity.first).explosivePower;
+           std::vector<unsigned int> debrisVoxels;
+           for(unsigned int j{0};j<vv.size();j++){
+             glm::vec3 vP {vM.getVoxelPosition(vv[j])};
+             vP+=0.5f;
+             if(vM.getColor(vv[j])[3] != 0.f && (eP*eP) >=  (x-vP[0])*(x-vP[0])+(y-vP[1])*(y-vP[1])+(z-vP[2])*(z-vP[2]))debrisVoxels.push_back(vv[j]);
+           }
+           m_gulgEngine.getCommandBuffer().instantiate(m_gulgEngine.getPrefab("Debris"), debrisVoxels.size(), [&](Gg::PrefabInstance &instance) {
+             glm::vec3 vP {vM.getVoxelPosition(debrisVoxels[instance.getIndex()])};
+             vP+=0.5f;
+             Gg::Component::VoxelMesh &newGMesh{instance.getAs<Gg::Component::Mesh, Gg::Component::VoxelMesh>()};
+             newGMesh.setColor(glm::vec3{vM.getColor(debrisVoxels[instance.getIndex()])});
+             vP*=-1.f;
+             instance.get<Gg::Component::Transformation>().translate(vP);
+             glm::vec3 f{vP - ePosition  };
+             f=glm::normalize(f);
+             if(f[2]>0.f)f[2] = -f[2];
+             instance.get<Gg::Component::Forces>().addForce(f*(eP/2.f));
+             instance.get<Gg::Component::Timer>().restart();
+           });
+
+           FMOD_RESULT fmodResult;
+           FMOD::Studio::EventInstance *explosioneventInstance{nullptr};
+           fmodResult = collisions->explosioneventDescription->createInstance(&explosioneventInstance);
+
+            if (fmodResult != FMOD_OK) {
+
+               std::cout << "Error " << fmodResult << " with FMOD studio API event creation: " << FMOD_ErrorString(fmodResult) << std::endl;
+           }
+           FMOD_3D_ATTRIBUTES att3D{
+             FMOD_VECTOR{ eT[3][0],eT[3][1],eT[3][2]},
+             FMOD_VECTOR{0.f,0.f,0.f },
+             FMOD_VECTOR{ 0.f,-1.f,0.f},
+             FMOD_VECTOR{0.f,0.f,-1.f}};
+           explosioneventInstance->set3DAttributes(&att3D);
+           explosioneventInstance->setVolume(0.4f);
+           explosioneventInstance->start();
+           explosioneventInstance->release();
       }
       //For each entity :
     	/*for(std::pair<Gg::Entity,Gg::Entity> collidingEntity: collisions->entity_entity_collisions) {
       }*/
-      if(explode)   {
-        localRemeshing(vxsToRs,*vM , *std::static_pointer_cast<Gg::Component::Mesh>(m_gulgEngine.getComponent(world, "MainMesh")));
-        std::static_pointer_cast<Gg::Component::Mesh>(m_gulgEngine.getComponent(world, "MainMesh"))->reshape();
-       }
 
 
     }
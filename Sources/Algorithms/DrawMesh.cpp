@@ -7,35 +7,50 @@ namespace Algorithm {
 DrawMesh::DrawMesh(const std::string componentToApply, Gg::Entity &cameraEntity, glm::mat4 &projectionMatrix, GulgEngine &gulgEngine):
 	SpecializedAlgorithm{componentToApply, gulgEngine},
 	m_cameraEntity{cameraEntity},
-	m_projectionMatrix{projectionMatrix} {
+	m_projectionMatrix{projectionMatrix},
+	m_uploadedBytes{0} {
 
-	m_signature += gulgEngine.getComponentSignature("SceneObject");
+	m_signature += gulgEngine.getComponentSignature<Gg::Component::SceneObject>();
+
+	// Drawing uploads the meshes waiting for it and caches inverted matrices, so both are written
+
+	writes<Gg::Component::SceneObject, Gg::Component::LevelOfDetail>();
+	m_writeSignature += gulgEngine.getComponentSignature(m_componentIDToApply);
+	m_mainThreadOnly = true;
 }
 
 DrawMesh::~DrawMesh() {}
 
 void DrawMesh::apply() {
 
+	m_uploadedBytes = 0;
+
 	if(m_cameraEntity != Gg::NoEntity) {
 
 		glm::mat4 viewMatrix{
 
-			std::static_pointer_cast<Gg::Component::SceneObject>(m_gulgEngine.getComponent(m_cameraEntity, "SceneObject"))->m_globalTransformations
+			m_gulgEngine.getComponent<Gg::Component::SceneObject>(m_cameraEntity).m_globalTransformations
 		};
 
 		for(Gg::Entity currentEntity: m_entitiesToApply) {
 
-			std::shared_ptr<Gg::Component::Mesh> currentMesh{
-				std::static_pointer_cast<Gg::Component::Mesh>(m_gulgEngine.getComponent(currentEntity, m_componentToApply))
-			};
+			Gg::Component::Mesh *currentMesh{&static_cast<Gg::Component::Mesh&>(*m_gulgEngine.getComponent(currentEntity, m_componentIDToApply))};
+
+			// Far chunks draw a coarser mesh instead
 
-			std::shared_ptr<Gg::Component::SceneObject> currentTransformation{
-				std::static_pointer_cast<Gg::Component::SceneObject>(m_gulgEngine.getComponent(currentEntity, "SceneObject"))
-			};
+			if(m_gulgEngine.entityHasComponent<Gg::Component::LevelOfDetail>(currentEntity)) {
 
-			currentMesh->draw(glm::inverse(currentTransformation->m_globalTransformations), viewMatrix, m_projectionMatrix);
+				Gg::Component::LevelOfDetail &levelOfDetail{m_gulgEngine.getComponent<Gg::Component::LevelOfDetail>(currentEntity)};
+				if(levelOfDetail.getLevel() > 0) { currentMesh = &levelOfDetail.getMesh(levelOfDetail.getLevel()); }
+			}
+
+			Gg::Component::SceneObject &currentTransformation{m_gulgEngine.getComponent<Gg::Component::SceneObject>(currentEntity)};
+
+			m_uploadedBytes += currentMesh->draw(currentTransformation.getInverseGlobalTransformations(), viewMatrix, m_projectionMatrix);
 		}
 	}
 }
 
+size_t DrawMesh::getUploadedBytes() const { return m_uploadedBytes; }
+
 }}
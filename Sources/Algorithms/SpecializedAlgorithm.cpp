@@ -6,9 +6,10 @@ namespace Algorithm {
 
 SpecializedAlgorithm::SpecializedAlgorithm(const std::string componentToApply, GulgEngine &gulgEngine): 
 	AbstractAlgorithm{gulgEngine},
-	m_componentToApply{componentToApply} {
+	m_componentToApply{componentToApply},
+	m_componentIDToApply{gulgEngine.getComponentID(componentToApply)} {
 
-	m_signature = m_gulgEngine.getComponentSignature(m_componentToApply);
+	m_signature = m_gulgEngine.getComponentSignature(m_componentIDToApply);
 }
 
 SpecializedAlgorithm::~SpecializedAlgorithm() {}
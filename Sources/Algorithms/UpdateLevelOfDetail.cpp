@@ -0,0 +1,85 @@
+#include "Algorithms/UpdateLevelOfDetail.hpp"
+
+namespace Gg {
+
+namespace Algorithm {
+
+UpdateLevelOfDetail::UpdateLevelOfDetail(Gg::Entity &cameraEntity, GulgEngine &gulgEngine):
+	AbstractAlgorithm{gulgEngine},
+	m_cameraEntity{cameraEntity},
+	m_statistics{{0, 0, 0, 0}, 0, 0, 0} {
+
+	m_signature = gulgEngine.getComponentSignature<VoxelMap>();
+
+	// Positions come from the cached inverted matrices of the scene objects
+
+	reads<VoxelMap, Gg::Component::Mesh>();
+	writes<Gg::Component::LevelOfDetail, Gg::Component::SceneObject>();
+}
+
+UpdateLevelOfDetail::~UpdateLevelOfDetail() {}
+
+void UpdateLevelOfDetail::apply() {
+
+	m_statistics = LevelOfDetailStatistics{{0, 0, 0, 0}, 0, 0, 0};
+
+	if(m_cameraEntity == Gg::NoEntity) { return; }
+
+	// The camera transformations are the view matrix, drawn meshes are moved by their inverse
+
+	const glm::vec3 cameraPosition{m_gulgEngine.getComponent<Gg::Component::SceneObject>(m_cameraEntity).getInverseGlobalTransformations()[3]};
+	const glm::vec4 chunkCenter{glm::vec3{VoxelMap::ChunkSize/2}, 1.f};
+
+	for(Gg::Entity currentEntity: m_entitiesToApply) {
+
+		const VoxelMap &map{m_gulgEngine.getComponent<VoxelMap>(currentEntity)};
+		std::vector<std::pair<unsigned int, Gg::Component::LevelOfDetail*>> chunksToBuild;
+
+		for(unsigned int chunk{0}; chunk < map.getNbChunks(); chunk++) {
+
+			const Gg::Entity meshEntity{map.getChunk(chunk).meshEntity};
+			if(meshEntity == Gg::NoEntity || !m_gulgEngine.entityHasComponent<Gg::Component::LevelOfDetail>(meshEntity)) { continue; }
+
+			Gg::Component::LevelOfDetail &levelOfDetail{m_gulgEngine.getComponent<Gg::Component::LevelOfDetail>(meshEntity)};
+			Gg::Component::SceneObject &chunkScene{m_gulgEngine.getComponent<Gg::Component::SceneObject>(meshEntity)};
+
+			const glm::vec3 center{chunkScene.getInverseGlobalTransformations()*chunkCenter};
+			levelOfDetail.selectLevel(glm::distance(center, cameraPosition));
+
+			const unsigned int level{levelOfDetail.getLevel()};
+			const Gg::Component::VoxelMesh &mainMesh{m_gulgEngine.getComponentAs<Gg::Component::Mesh, Gg::Component::VoxelMesh>(meshEntity)};
+
+			m_statistics.nbChunks[level]++;
+			m_statistics.nbFullDetailTriangles += mainMesh.getNbIndices()/3;
+
+			if(level == 0) { m_statistics.nbTriangles += mainMesh.getNbIndices()/3; }
+			else if(levelOfDetail.isOutdated(level, map.getChunk(chunk).meshVersion)) { chunksToBuild.emplace_back(chunk, &levelOfDetail); }
+			else { m_statistics.nbTriangles += levelOfDetail.getMesh(level).getNbIndices()/3; }
+		}
+
+		m_gulgEngine.getJobSystem().parallelFor(chunksToBuild.size(), 1, [&map, &chunksToBuild](const size_t begin, const size_t end) {
+
+			for(size_t i{begin}; i < end; i++) {
+
+				Gg::Component::LevelOfDetail &levelOfDetail{*chunksToBuild[i].second};
+				levelOfDetailToMesh(map, chunksToBuild[i].first, levelOfDetail.getLevel(), levelOfDetail.getMesh(levelOfDetail.getLevel()));
+			}
+		});
+
+		for(const std::pair<unsigned int, Gg::Component::LevelOfDetail*> &chunk: chunksToBuild) {
+
+			const unsigned int level{chunk.second->getLevel()};
+
+			chunk.second->setMeshVersion(level, map.getChunk(chunk.first).meshVersion);
+			chunk.second->getMesh(level).reshape();
+
+			m_statistics.nbTriangles += chunk.second->getMesh(level).getNbIndices()/3;
+		}
+
+		m_statistics.nbBuiltMeshes += chunksToBuild.size();
+	}
+}
+
+const LevelOfDetailStatistics &UpdateLevelOfDetail::getStatistics() const { return m_statistics; }
+
+}}
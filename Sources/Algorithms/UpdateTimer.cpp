@@ -9,7 +9,10 @@ namespace Gg {
     UpdateTimer::UpdateTimer(Gg::GulgEngine &gulgEngine,Gg::Entity &w, Time* c):
       AbstractAlgorithm{gulgEngine},world{w},timeSystem(c) {
 
-        m_signature = gulgEngine.getComponentSignature("Timer");
+        m_signature = gulgEngine.getComponentSignature<Gg::Component::Timer>();
+
+        reads<Gg::Component::Timer, Gg::Component::Explosive, Gg::Component::SceneObject>();
+        writes<VoxelMap>();
 
     }
     UpdateTimer::~UpdateTimer() {}
@@ -17,52 +20,39 @@ namespace Gg {
 
     void UpdateTimer::apply() {
       std::vector<std::vector<unsigned int>> vxsToRs;
-      std::shared_ptr<VoxelMap> vM{
-        std::static_pointer_cast<VoxelMap>(m_gulgEngine.getComponent(world, "VoxelMap"))
-      };
-      bool explode{false};
+      VoxelMap &vM{m_gulgEngine.getComponent<VoxelMap>(world)};
       // std::cout<< m_entitiesToApply.size()<<std::endl;
       for(unsigned int i =0; i < m_entitiesToApply.size();i++) {
-        if(std::static_pointer_cast<Gg::Component::Timer>(m_gulgEngine.getComponent(m_entitiesToApply[i], "Timer"))->end <= std::chrono::system_clock::now()){
-          if( m_gulgEngine.entityHasComponent(m_entitiesToApply[i],"Explosive")
-          && m_gulgEngine.entityHasComponent(m_entitiesToApply[i],"SceneObject")){
-            glm::mat4 eT{std::static_pointer_cast<Gg::Component::SceneObject>(m_gulgEngine.getComponent(m_entitiesToApply[i], "SceneObject"))->m_globalTransformations};
+        if(m_gulgEngine.getComponent<Gg::Component::Timer>(m_entitiesToApply[i]).end <= std::chrono::system_clock::now()){
+          if( m_gulgEngine.entityHasComponent<Gg::Component::Explosive>(m_entitiesToApply[i])
+          && m_gulgEngine.entityHasComponent<Gg::Component::SceneObject>(m_entitiesToApply[i])){
+            glm::mat4 eT{m_gulgEngine.getComponent<Gg::Component::SceneObject>(m_entitiesToApply[i]).m_globalTransformations};
             glm::vec3 ePosition{
               eT[3][0],eT[3][1],eT[3][2]
             };
-            float eP = std::static_pointer_cast<Gg::Component::Explosive>(m_gulgEngine.getComponent(m_entitiesToApply[i], "Explosive"))->explosivePower;
-            vxsToRs.push_back(vM->explode(-1.f*ePosition[0],-1.f*ePosition[1],-1.f*ePosition[2],std::static_pointer_cast<Gg::Component::Explosive>(m_gulgEngine.getComponent(m_entitiesToApply[i], "Explosive"))->explosivePower));
+            float eP = m_gulgEngine.getComponent<Gg::Component::Explosive>(m_entitiesToApply[i]).explosivePower;
+            vxsToRs.push_back(vM.explode(-1.f*ePosition[0],-1.f*ePosition[1],-1.f*ePosition[2],m_gulgEngine.getComponent<Gg::Component::Explosive>(m_entitiesToApply[i]).explosivePower));
             std::vector<unsigned int> vv = vxsToRs[vxsToRs.size()-1];
-            explode=true;
             float x { -1.f*ePosition[0]}, y {-1.f*ePosition[1]}, z {-1.f*ePosition[2]};
+            std::vector<unsigned int> debrisVoxels;
             for(unsigned int j{0};j<vv.size();j++){
-              glm::vec3 vP {vM->getVoxelPosition(vv[j])};
+              glm::vec3 vP {vM.getVoxelPosition(vv[j])};
               vP+=0.5f;
-              if(vM->getColor(vv[j])[3] != 0.f && (eP*eP) >=  (x-vP[0])*(x-vP[0])+(y-vP[1])*(y-vP[1])+(z-vP[2])*(z-vP[2]) ){
-                Gg::Entity newG{m_gulgEngine.getNewEntity()};
-                std::shared_ptr<Gg::Component::SceneObject> newGScene{std::make_shared<Gg::Component::SceneObject>()};
-                std::shared_ptr<Gg::Component::Transformation> newGTransformation{std::make_shared<Gg::Component::Transformation>()};
-                std::shared_ptr<Gg::Component::Collider> newGCollider{std::make_shared<Gg::Component::Collider>()};
-                std::shared_ptr<Gg::Component::Forces> newGForces{std::make_shared<Gg::Component::Forces>(glm::vec3{0.f},0.1f,1.f,2.f)};
-                std::shared_ptr<Gg::Component::Mesh> newGMesh{std::make_shared<Gg::Component::Mesh>(m_gulgEngine.getProgram("MainProgram"))};
-                std::shared_ptr<Gg::Component::Timer> newGTimer{std::make_shared<Gg::Component::Timer>(5000)};
-                Cube(newGMesh,0.5f,vM->getColor(vv[j]));
-                vP*=-1.f;
-                newGTransformation->translate(vP);
-                glm::vec3 f{vP - ePosition  };
-                f=glm::normalize(f);
-                if(f[2]>0.f)f[2] = -f[2];
-                newGForces->addForce(f*eP);
-                m_gulgEngine.addComponentToEntity(newG, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGScene));
-                m_gulgEngine.addComponentToEntity(newG, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGTransformation));
-                m_gulgEngine.addComponentToEntity(newG, "Collider", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGCollider));
-                m_gulgEngine.addComponentToEntity(newG, "Forces", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGForces));
-                m_gulgEngine.addComponentToEntity(newG, "MainMesh", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGMesh));
-                m_gulgEngine.addComponentToEntity(newG, "Timer", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGTimer));
-                timeSystem->toAdd.push_back(newG);
-
-              }
+              if(vM.getColor(vv[j])[3] != 0.f && (eP*eP) >=  (x-vP[0])*(x-vP[0])+(y-vP[1])*(y-vP[1])+(z-vP[2])*(z-vP[2]))debrisVoxels.push_back(vv[j]);
             }
+            m_gulgEngine.getCommandBuffer().instantiate(m_gulgEngine.getPrefab("Debris"), debrisVoxels.size(), [&](Gg::PrefabInstance &instance) {
+              glm::vec3 vP {vM.getVoxelPosition(debrisVoxels[instance.getIndex()])};
+              vP+=0.5f;
+              Gg::Component::VoxelMesh &newGMesh{instance.getAs<Gg::Component::Mesh, Gg::Component::VoxelMesh>()};
+              newGMesh.setColor(glm::vec3{vM.getColor(debrisVoxels[instance.getIndex()])});
+              vP*=-1.f;
+              instance.get<Gg::Component::Transformation>().translate(vP);
+              glm::vec3 f{vP - ePosition  };
+              f=glm::normalize(f);
+              if(f[2]>0.f)f[2] = -f[2];
+              instance.get<Gg::Component::Forces>().addForce(f*eP);
+              instance.get<Gg::Component::Timer>().restart();
+            });
             FMOD_RESULT fmodResult;
             FMOD::Studio::EventInstance *explosioneventInstance{nullptr};
             fmodResult = timeSystem->explosioneventDescription->createInstance(&explosioneventInstance);
@@ -81,14 +71,10 @@ namespace Gg {
             explosioneventInstance->start();
             explosioneventInstance->release();
             }
-          timeSystem->toDelete.push_back(m_entitiesToApply[i]);
+          m_gulgEngine.getCommandBuffer().deleteEntity(m_entitiesToApply[i]);
         }
 
       }
-      if(explode)   {
-        localRemeshing(vxsToRs,*vM , *std::static_pointer_cast<Gg::Component::Mesh>(m_gulgEngine.getComponent(world, "MainMesh")));
-        std::static_pointer_cast<Gg::Component::Mesh>(m_gulgEngine.getComponent(world, "MainMesh"))->reshape();
-       }
 
 
     }
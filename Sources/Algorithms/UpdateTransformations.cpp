@@ -5,35 +5,71 @@ namespace Gg {
 namespace Algorithm {
 
 UpdateTransformations::UpdateTransformations(Gg::GulgEngine &gulgEngine): 
-	AbstractAlgorithm{gulgEngine} {
+	AbstractAlgorithm{gulgEngine}, m_sceneIsKnown{false}, m_nbUpdatedNodes{0} {
 
-	m_signature = gulgEngine.getComponentSignature("SceneObject");
-	m_signature += gulgEngine.getComponentSignature("Transformations");
+	m_signature = gulgEngine.getComponentSignature<Gg::Component::SceneObject>();
+	m_signature += gulgEngine.getComponentSignature<Gg::Component::Transformation>();
+
+	writes<Gg::Component::Transformation, Gg::Component::SceneObject>();
+
+	// Nodes come from the engine scene graph, already sorted so that parents come first
+
+	m_subscribeToEngine = false;
 }
 
 UpdateTransformations::~UpdateTransformations() {}
 
 void UpdateTransformations::apply() {
 
-	for(Gg::Entity currentEntity: m_entitiesToApply) { applyTransformations(currentEntity); }
-}
+	SceneGraph &sceneGraph{m_gulgEngine.getSceneGraph()};
+	const std::vector<Gg::Entity> &order{sceneGraph.getOrder()};
+	const std::vector<unsigned int> &parents{sceneGraph.getParentIndices()};
+
+	// Global matrices are cached by entity, so they stay valid when the order is rebuilt. Only the
+	// nodes attached or reparented since the last run are recomputed with their descendants,
+	// every node the first time.
+
+	const bool isFirstRun{!m_sceneIsKnown};
+	m_sceneIsKnown = true;
+
+	for(const Gg::Entity movedNode: sceneGraph.takeMovedNodes()) {
+
+		const unsigned int index{getEntityIndex(movedNode)};
 
-void UpdateTransformations::applyTransformations(const Gg::Entity entity, const glm::mat4 transformation) {
+		if(index >= m_hasMoved.size()) { m_hasMoved.resize(index + 1, false); }
+		m_hasMoved[index] = true;
+	}
+
+	m_hasChanged.resize(order.size());
+	m_nbUpdatedNodes = 0;
+
+	for(size_t i{0}; i < order.size(); i++) {
+
+		const unsigned int index{getEntityIndex(order[i])};
 
-	std::shared_ptr<Gg::Component::Transformation> currentTransformation{ 
-			std::static_pointer_cast<Gg::Component::Transformation>(m_gulgEngine.getComponent(entity, "Transformations"))
-	};
+		if(index >= m_globalTransformations.size()) { m_globalTransformations.resize(index + 1); }
+		if(index >= m_hasMoved.size()) { m_hasMoved.resize(index + 1, false); }
 
-	std::shared_ptr<Gg::Component::SceneObject> currentSceneObject{ 
-			std::static_pointer_cast<Gg::Component::SceneObject>(m_gulgEngine.getComponent(entity, "SceneObject"))
-	};
+		Gg::Component::Transformation &transformation{m_gulgEngine.getComponent<Gg::Component::Transformation>(order[i])};
+		const bool hasParent{parents[i] != SceneGraph::NoParent};
 
-	currentSceneObject->m_globalTransformations = currentTransformation->getTransformationMatrix()*transformation;
+		const bool localHasChanged{transformation.needUpdate()};
 
-	for(Gg::Entity childEntity: currentSceneObject->m_children) {
+		m_hasChanged[i] = isFirstRun || m_hasMoved[index] || localHasChanged || (hasParent && m_hasChanged[parents[i]]);
+		m_hasMoved[index] = false;
 
-		applyTransformations(childEntity, currentSceneObject->m_globalTransformations);
+		if(!m_hasChanged[i]) { continue; }
+
+		const glm::mat4 &local{localHasChanged ? transformation.update() : transformation.getTransformationMatrix()};
+
+		if(hasParent) { m_globalTransformations[index] = local*m_globalTransformations[getEntityIndex(order[parents[i]])]; }
+		else { m_globalTransformations[index] = local; }
+
+		m_gulgEngine.getComponent<Gg::Component::SceneObject>(order[i]).setGlobalTransformations(m_globalTransformations[index]);
+		m_nbUpdatedNodes++;
 	}
 }
 
+size_t UpdateTransformations::getNbUpdatedNodes() const { return m_nbUpdatedNodes; }
+
 }}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "Algorithms/UpdateVoxelMeshes.hpp"
+
+namespace Gg {
+
+namespace Algorithm {
+
+UpdateVoxelMeshes::UpdateVoxelMeshes(Gg::GulgEngine &gulgEngine):
+	AbstractAlgorithm{gulgEngine}, m_statistics{0, 0, 0, 0, 0} {
+
+	m_signature = gulgEngine.getComponentSignature<VoxelMap>();
+
+	// Meshing clears the dirty chunks of the map
+
+	writes<VoxelMap, Gg::Component::Mesh>();
+}
+
+UpdateVoxelMeshes::~UpdateVoxelMeshes() {}
+
+void UpdateVoxelMeshes::apply() {
+
+	m_statistics = VoxelMeshStatistics{0, 0, 0, 0, 0};
+
+	for(Gg::Entity currentEntity: m_entitiesToApply) {
+
+		const VoxelMeshStatistics mapStatistics{remeshVoxelMap(m_gulgEngine, m_gulgEngine.getComponent<VoxelMap>(currentEntity))};
+
+		m_statistics.nbRemeshedChunks += mapStatistics.nbRemeshedChunks;
+		m_statistics.nbVerticesBefore += mapStatistics.nbVerticesBefore;
+		m_statistics.nbVerticesAfter += mapStatistics.nbVerticesAfter;
+		m_statistics.nbIndicesBefore += mapStatistics.nbIndicesBefore;
+		m_statistics.nbIndicesAfter += mapStatistics.nbIndicesAfter;
+	}
+}
+
+unsigned int UpdateVoxelMeshes::getNbRemeshedChunks() const { return m_statistics.nbRemeshedChunks; }
+
+const VoxelMeshStatistics &UpdateVoxelMeshes::getStatistics() const { return m_statistics; }
+
+}}
@@ -2,12 +2,16 @@
 namespace Gg {
 
   namespace Component {
-    Timer::Timer():end{std::chrono::system_clock::now() + std::chrono::seconds(5)}
+    Timer::Timer():duration{5000},end{std::chrono::system_clock::now() + std::chrono::milliseconds(duration)}
     {}
-    Timer::Timer(long millisecs):end{std::chrono::system_clock::now() + std::chrono::milliseconds(millisecs)}
+    Timer::Timer(long millisecs):duration{millisecs},end{std::chrono::system_clock::now() + std::chrono::milliseconds(millisecs)}
     {}
 
-    Timer::Timer(const Timer &t):end{t.end}
+    Timer::Timer(const Timer &t):duration{t.duration},end{t.end}
      {}
+
+    void Timer::restart(){
+      end = std::chrono::system_clock::now() + std::chrono::milliseconds(duration);
+    }
   }
 }
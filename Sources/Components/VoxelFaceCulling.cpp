@@ -0,0 +1,158 @@
+#include "Components/VoxelFaceCulling.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GULG_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+static_assert(VoxelMap::ChunkSize == 32, "The kernels give one 32 bits mask per column and direction");
+
+constexpr unsigned int ChunkSize{VoxelMap::ChunkSize}, PaddedSize{VoxelMap::ChunkSize + 2}, DirectionStride{VoxelMap::ChunkSize*VoxelMap::ChunkSize};
+
+// Columns are padded, faces aren't: the column of (x, y) is at (x + 1)*PaddedSize + y + 1 and its faces
+// at direction*DirectionStride + x*ChunkSize + y. Masks are shifted down once to drop the margin.
+
+static void cullScalar(const std::uint64_t *columns, std::uint32_t *faces) {
+
+	for(unsigned int x{0}; x < ChunkSize; x++) {
+		for(unsigned int y{0}; y < ChunkSize; y++) {
+
+			const std::uint64_t *center{columns + (x + 1)*PaddedSize + y + 1};
+			const std::uint64_t solid{*center};
+			std::uint32_t *out{faces + x*ChunkSize + y};
+
+			out[0] = static_cast<std::uint32_t>((solid & ~center[PaddedSize]) >> 1);
+			out[DirectionStride] = static_cast<std::uint32_t>((solid & ~*(center - PaddedSize)) >> 1);
+			out[2*DirectionStride] = static_cast<std::uint32_t>((solid & ~center[1]) >> 1);
+			out[3*DirectionStride] = static_cast<std::uint32_t>((solid & ~*(center - 1)) >> 1);
+			out[4*DirectionStride] = static_cast<std::uint32_t>((solid & ~(solid >> 1)) >> 1);
+			out[5*DirectionStride] = static_cast<std::uint32_t>((solid & ~(solid << 1)) >> 1);
+		}
+	}
+}
+
+#ifdef GULG_X86_KERNELS
+
+__attribute__((target("sse2"))) static inline void storeSSE2(std::uint32_t *out, const __m128i faces) {
+
+	// Low halves of the two lanes, next to each other
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi32(_mm_srli_epi64(faces, 1), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+__attribute__((target("sse2"))) static void cullSSE2(const std::uint64_t *columns, std::uint32_t *faces) {
+
+	for(unsigned int x{0}; x < ChunkSize; x++) {
+		for(unsigned int y{0}; y < ChunkSize; y += 2) {
+
+			const std::uint64_t *center{columns + (x + 1)*PaddedSize + y + 1};
+			const __m128i solid{_mm_loadu_si128(reinterpret_cast<const __m128i*>(center))};
+			std::uint32_t *out{faces + x*ChunkSize + y};
+
+			storeSSE2(out, _mm_andnot_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(center + PaddedSize)), solid));
+			storeSSE2(out + DirectionStride, _mm_andnot_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(center - PaddedSize)), solid));
+			storeSSE2(out + 2*DirectionStride, _mm_andnot_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(center + 1)), solid));
+			storeSSE2(out + 3*DirectionStride, _mm_andnot_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(center - 1)), solid));
+			storeSSE2(out + 4*DirectionStride, _mm_andnot_si128(_mm_srli_epi64(solid, 1), solid));
+			storeSSE2(out + 5*DirectionStride, _mm_andnot_si128(_mm_slli_epi64(solid, 1), solid));
+		}
+	}
+}
+
+__attribute__((target("avx2"))) static inline void storeAVX2(std::uint32_t *out, const __m256i faces) {
+
+	// Low halves of the four lanes, packed in the low 128 bits
+	const __m256i packed{_mm256_permutevar8x32_epi32(_mm256_srli_epi64(faces, 1), _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6))};
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+}
+
+__attribute__((target("avx2"))) static void cullAVX2(const std::uint64_t *columns, std::uint32_t *faces) {
+
+	for(unsigned int x{0}; x < ChunkSize; x++) {
+		for(unsigned int y{0}; y < ChunkSize; y += 4) {
+
+			const std::uint64_t *center{columns + (x + 1)*PaddedSize + y + 1};
+			const __m256i solid{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(center))};
+			std::uint32_t *out{faces + x*ChunkSize + y};
+
+			storeAVX2(out, _mm256_andnot_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(center + PaddedSize)), solid));
+			storeAVX2(out + DirectionStride, _mm256_andnot_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(center - PaddedSize)), solid));
+			storeAVX2(out + 2*DirectionStride, _mm256_andnot_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(center + 1)), solid));
+			storeAVX2(out + 3*DirectionStride, _mm256_andnot_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(center - 1)), solid));
+			storeAVX2(out + 4*DirectionStride, _mm256_andnot_si256(_mm256_srli_epi64(solid, 1), solid));
+			storeAVX2(out + 5*DirectionStride, _mm256_andnot_si256(_mm256_slli_epi64(solid, 1), solid));
+		}
+	}
+}
+
+#endif
+
+VoxelFaceCulling::VoxelFaceCulling(): m_kernel{getBestKernel()} {}
+
+bool VoxelFaceCulling::isSupported(const Kernel kernel) {
+
+	#ifdef GULG_X86_KERNELS
+
+	if(kernel == Kernel::SSE2) { return __builtin_cpu_supports("sse2"); }
+	if(kernel == Kernel::AVX2) { return __builtin_cpu_supports("avx2"); }
+
+	#endif
+
+	return kernel == Kernel::Scalar;
+}
+
+VoxelFaceCulling::Kernel VoxelFaceCulling::getBestKernel() {
+
+	if(isSupported(Kernel::AVX2)) { return Kernel::AVX2; }
+	if(isSupported(Kernel::SSE2)) { return Kernel::SSE2; }
+
+	return Kernel::Scalar;
+}
+
+void VoxelFaceCulling::setKernel(const Kernel kernel) {
+
+	if(!isSupported(kernel)) { throw std::runtime_error("Gulg error: face culling kernel not supported by this CPU."); }
+	m_kernel = kernel;
+}
+
+VoxelFaceCulling::Kernel VoxelFaceCulling::getKernel() const { return m_kernel; }
+
+void VoxelFaceCulling::cull(const VoxelMap &map, const unsigned int chunk) {
+
+	const std::array<unsigned int, 3> &origin{map.getChunk(chunk).origin};
+	const std::array<unsigned int, 3> worldSize{map.getWorldDimensions()};
+	const unsigned int nbWords{map.getNbColumnWords()}, below{origin[2] - 1}, above{origin[2] + ChunkSize};
+
+	for(unsigned int i{0}; i < PaddedSize; i++) {
+		for(unsigned int j{0}; j < PaddedSize; j++) {
+
+			// Wraps around for the margin under 0, which is outside of the world as well
+			const unsigned int x{origin[0] + i - 1}, y{origin[1] + j - 1};
+			std::uint64_t &column{m_columns[i*PaddedSize + j]};
+
+			if(x >= worldSize[0] || y >= worldSize[1]) { column = 0; continue; }
+
+			const std::uint64_t *words{map.getColumn(x, y)};
+			column = ((words[origin[2]/64] >> (origin[2] % 64)) & 0xFFFFFFFFu) << 1;
+
+			if(origin[2] > 0) { column |= (words[below/64] >> (below % 64)) & 1u; }
+			if(above/64 < nbWords) { column |= ((words[above/64] >> (above % 64)) & 1u) << (ChunkSize + 1); }
+		}
+	}
+
+	#ifdef GULG_X86_KERNELS
+
+	if(m_kernel == Kernel::AVX2) { cullAVX2(m_columns.data(), m_faces.data()); return; }
+	if(m_kernel == Kernel::SSE2) { cullSSE2(m_columns.data(), m_faces.data()); return; }
+
+	#endif
+
+	cullScalar(m_columns.data(), m_faces.data());
+}
+
+std::uint32_t VoxelFaceCulling::getAllFaces(const unsigned int x, const unsigned int y) const {
+
+	std::uint32_t faces{0};
+	for(unsigned int direction{0}; direction < 6; direction++) { faces |= getFaces(direction, x, y); }
+
+	return faces;
+}
@@ -0,0 +1,120 @@
+#include "Components/VoxelFaceIndex.hpp"
+
+VoxelFaceIndex::VoxelFaceIndex(): m_size{0}, m_shift{32} {}
+
+void VoxelFaceIndex::insert(const unsigned int localVoxel, const unsigned int direction, const unsigned int face) {
+
+	if((m_size + 1)*4 > m_keys.size()*3) { grow(); }
+
+	const std::uint32_t key{makeKey(localVoxel, direction)};
+	const size_t mask{m_keys.size() - 1};
+
+	size_t slot{getSlot(key)};
+	while(m_keys[slot] != EmptyKey && m_keys[slot] != key) { slot = (slot + 1) & mask; }
+
+	if(m_keys[slot] == EmptyKey) { m_size++; }
+
+	m_keys[slot] = key;
+	m_faces[slot] = face;
+}
+
+unsigned int VoxelFaceIndex::find(const unsigned int localVoxel, const unsigned int direction) const {
+
+	if(m_size == 0) { return NoFace; }
+
+	const std::uint32_t key{makeKey(localVoxel, direction)};
+	const size_t mask{m_keys.size() - 1};
+
+	for(size_t slot{getSlot(key)}; m_keys[slot] != EmptyKey; slot = (slot + 1) & mask) {
+
+		if(m_keys[slot] == key) { return m_faces[slot]; }
+	}
+
+	return NoFace;
+}
+
+unsigned int VoxelFaceIndex::erase(const unsigned int localVoxel, const unsigned int direction) {
+
+	if(m_size == 0) { return NoFace; }
+
+	const std::uint32_t key{makeKey(localVoxel, direction)};
+	const size_t mask{m_keys.size() - 1};
+
+	size_t slot{getSlot(key)};
+	while(m_keys[slot] != key) {
+
+		if(m_keys[slot] == EmptyKey) { return NoFace; }
+		slot = (slot + 1) & mask;
+	}
+
+	const unsigned int face{m_faces[slot]};
+
+	// Moves back the next entries of the cluster which would not be found anymore through the hole
+
+	size_t hole{slot};
+	for(size_t next{(slot + 1) & mask}; m_keys[next] != EmptyKey; next = (next + 1) & mask) {
+
+		const size_t wanted{getSlot(m_keys[next])};
+
+		if(((next - wanted) & mask) >= ((next - hole) & mask)) {
+
+			m_keys[hole] = m_keys[next];
+			m_faces[hole] = m_faces[next];
+			hole = next;
+		}
+	}
+
+	m_keys[hole] = EmptyKey;
+	m_size--;
+
+	return face;
+}
+
+void VoxelFaceIndex::clear() {
+
+	m_keys.clear();
+	m_faces.clear();
+	m_size = 0;
+	m_shift = 32;
+}
+
+size_t VoxelFaceIndex::size() const { return m_size; }
+
+std::uint32_t VoxelFaceIndex::makeKey(const unsigned int localVoxel, const unsigned int direction) {
+
+	return static_cast<std::uint32_t>(localVoxel*8 + direction);
+}
+
+size_t VoxelFaceIndex::getSlot(const std::uint32_t key) const {
+
+	// Fibonacci hashing, the high bits of the product are the best mixed
+
+	return static_cast<std::uint32_t>(key*std::uint32_t{2654435761u}) >> m_shift;
+}
+
+void VoxelFaceIndex::grow() {
+
+	std::vector<std::uint32_t> oldKeys, oldFaces;
+	oldKeys.swap(m_keys);
+	oldFaces.swap(m_faces);
+
+	const size_t capacity{oldKeys.empty() ? 64 : oldKeys.size()*2};
+	m_keys.assign(capacity, EmptyKey);
+	m_faces.assign(capacity, 0);
+
+	m_shift = 32;
+	for(size_t bits{capacity}; bits > 1; bits /= 2) { m_shift--; }
+
+	const size_t mask{capacity - 1};
+
+	for(size_t i{0}; i < oldKeys.size(); i++) {
+
+		if(oldKeys[i] == EmptyKey) { continue; }
+
+		size_t slot{getSlot(oldKeys[i])};
+		while(m_keys[slot] != EmptyKey) { slot = (slot + 1) & mask; }
+
+		m_keys[slot] = oldKeys[i];
+		m_faces[slot] = oldFaces[i];
+	}
+}
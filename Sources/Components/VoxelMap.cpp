@@ -1,17 +1,59 @@
 #include "Components/VoxelMap.hpp"
 
 VoxelMap::VoxelMap(const unsigned int x, const unsigned int y, const unsigned int z):
+	m_nbChunks{(x + ChunkSize - 1)/ChunkSize, (y + ChunkSize - 1)/ChunkSize, (z + ChunkSize - 1)/ChunkSize},
+	m_useWideIndices{false},
+	m_nbColumnWords{(z + 63)/64},
 	m_sizeX{x}, m_sizeY{y}, m_sizeZ{z} {
 
-	m_voxels.resize(m_sizeX*m_sizeY*m_sizeZ);
-	idVoxel_vertexInds.resize(m_sizeX*m_sizeY*m_sizeZ);
-	for(glm::vec4 &currentVoxel: m_voxels) {
+	m_occupancy.resize(m_sizeX*m_sizeY*m_nbColumnWords, 0);
 
-		currentVoxel = glm::vec4 {0.0f, 0.0f, 0.0f, 0.0f};
+	m_chunks.resize(m_nbChunks[0]*m_nbChunks[1]*m_nbChunks[2]);
+
+	for(unsigned int cx{0}; cx < m_nbChunks[0]; cx++) {
+		for(unsigned int cy{0}; cy < m_nbChunks[1]; cy++) {
+			for(unsigned int cz{0}; cz < m_nbChunks[2]; cz++) {
+
+				VoxelChunk &chunk{m_chunks[(cx*m_nbChunks[1] + cy)*m_nbChunks[2] + cz]};
+
+				chunk.origin = std::array<unsigned int, 3>{cx*ChunkSize, cy*ChunkSize, cz*ChunkSize};
+				chunk.neighbours = std::array<unsigned int, 6>{
+
+					cx + 1 < m_nbChunks[0] ? ((cx + 1)*m_nbChunks[1] + cy)*m_nbChunks[2] + cz : NoChunk,
+					cx > 0 ? ((cx - 1)*m_nbChunks[1] + cy)*m_nbChunks[2] + cz : NoChunk,
+					cy + 1 < m_nbChunks[1] ? (cx*m_nbChunks[1] + cy + 1)*m_nbChunks[2] + cz : NoChunk,
+					cy > 0 ? (cx*m_nbChunks[1] + cy - 1)*m_nbChunks[2] + cz : NoChunk,
+					cz + 1 < m_nbChunks[2] ? (cx*m_nbChunks[1] + cy)*m_nbChunks[2] + cz + 1 : NoChunk,
+					cz > 0 ? (cx*m_nbChunks[1] + cy)*m_nbChunks[2] + cz - 1 : NoChunk
+				};
+
+				chunk.size = std::array<unsigned int, 3>{
+
+					std::min(ChunkSize, m_sizeX - chunk.origin[0]),
+					std::min(ChunkSize, m_sizeY - chunk.origin[1]),
+					std::min(ChunkSize, m_sizeZ - chunk.origin[2])
+				};
+
+				chunk.needFullMesh = true;
+				chunk.meshing = VoxelMeshing::Culled;
+				chunk.meshVersion = 0;
+				chunk.meshEntity = Gg::NoEntity;
+			}
+		}
 	}
+
+	findOrAddColor(glm::vec4{0.0f, 0.0f, 0.0f, 0.0f});
 }
 
 VoxelMap::VoxelMap(const VoxelMap &map):
+	m_chunks{map.m_chunks},
+	m_nbChunks{map.m_nbChunks},
+	m_useWideIndices{map.m_useWideIndices},
+	m_occupancy{map.m_occupancy},
+	m_nbColumnWords{map.m_nbColumnWords},
+	m_palette{map.m_palette},
+	m_paletteIsSolid{map.m_paletteIsSolid},
+	m_paletteIndices{map.m_paletteIndices},
 	m_sizeX{map.m_sizeX},
 	m_sizeY{map.m_sizeY},
 	m_sizeZ{map.m_sizeZ} {}
@@ -24,7 +66,7 @@ glm::vec4 VoxelMap::getColor(const unsigned int x, const unsigned int y, const u
 		throw std::runtime_error("Error: try to acces to an voxel who is outside the world.");
 	}
 
-	return m_voxels[x*m_sizeY*m_sizeZ + y*m_sizeZ + z];
+	return m_palette[getIndex(x, y, z)];
 }
 
 void VoxelMap::setColor(const unsigned int x, const unsigned int y, const unsigned int z, const glm::vec4 &color) {
@@ -34,46 +76,144 @@ void VoxelMap::setColor(const unsigned int x, const unsigned int y, const unsign
 		throw std::runtime_error("Error: try to acces to an voxel who is outside the world.");
 	}
 
-	m_voxels[x*m_sizeY*m_sizeZ + y*m_sizeZ + z] = color;
+	const unsigned int index{findOrAddColor(color)};
+	if(index == getIndex(x, y, z)) { return; }
+
+	VoxelChunk &chunk{m_chunks[getChunkIndex(x, y, z)]};
+
+	// The storage of a chunk is only allocated with its first non empty voxel
+
+	const size_t chunkVolume{static_cast<size_t>(chunk.size[0])*chunk.size[1]*chunk.size[2]};
+
+	if(m_useWideIndices) {
+
+		if(chunk.wideIndices.empty()) { chunk.wideIndices.resize(chunkVolume, 0); }
+		chunk.wideIndices[getStorageIndex(chunk, x, y, z)] = static_cast<std::uint16_t>(index);
+	}
+
+	else {
+
+		if(chunk.indices.empty()) { chunk.indices.resize(chunkVolume, 0); }
+		chunk.indices[getStorageIndex(chunk, x, y, z)] = static_cast<std::uint8_t>(index);
+	}
+
+	const std::uint64_t bit{std::uint64_t{1} << (z % 64)};
+	std::uint64_t &word{m_occupancy[(x*m_sizeY + y)*m_nbColumnWords + z/64]};
+
+	if(m_paletteIsSolid[index]) { word |= bit; }
+	else { word &= ~bit; }
+
+	// The faces of the voxel and the facing faces of its neighbours, maybe in other chunks, have changed
+
+	recordEdit(x, y, z);
+	if(x + 1 < m_sizeX) { recordEdit(x + 1, y, z); }
+	if(x > 0) { recordEdit(x - 1, y, z); }
+	if(y + 1 < m_sizeY) { recordEdit(x, y + 1, z); }
+	if(y > 0) { recordEdit(x, y - 1, z); }
+	if(z + 1 < m_sizeZ) { recordEdit(x, y, z + 1); }
+	if(z > 0) { recordEdit(x, y, z - 1); }
 }
 
 glm::vec4 VoxelMap::getColor(const unsigned int voxelID) const {
 
-	if(voxelID > m_voxels.size()) {
+	checkVoxelID(voxelID);
+	return m_palette[getPaletteIndex(voxelID)];
+}
+
+void VoxelMap::setColor(const unsigned int voxelID, const glm::vec4 &color) {
+
+	checkVoxelID(voxelID);
+	setColor(voxelID/(m_sizeY*m_sizeZ), voxelID/m_sizeZ % m_sizeY, voxelID % m_sizeZ, color);
+}
+
+unsigned int VoxelMap::getVoxelID(const unsigned int x, const unsigned int y, const unsigned int z) const {
+
+	if(x >= m_sizeX || y >= m_sizeY || z >= m_sizeZ) {
 
 		throw std::runtime_error("Error: try to acces to an voxel who is outside the world.");
 	}
 
-	return m_voxels[voxelID];
+	return x*m_sizeY*m_sizeZ + y*m_sizeZ + z;
 }
 
-void VoxelMap::setColor(const unsigned int voxelID, const glm::vec4 &color) {
+bool VoxelMap::isSolid(const unsigned int x, const unsigned int y, const unsigned int z) const {
 
-	if(voxelID > m_voxels.size()) {
+	if(x >= m_sizeX || y >= m_sizeY || z >= m_sizeZ) {
 
 		throw std::runtime_error("Error: try to acces to an voxel who is outside the world.");
 	}
 
-	m_voxels[voxelID] = color;
+	return (m_occupancy[(x*m_sizeY + y)*m_nbColumnWords + z/64] >> (z % 64)) & std::uint64_t{1};
 }
 
-unsigned int VoxelMap::getVoxelID(const unsigned int x, const unsigned int y, const unsigned int z) const {
+bool VoxelMap::isSolid(const unsigned int voxelID) const {
 
-	if(x >= m_sizeX || y >= m_sizeY || z >= m_sizeZ) {
+	checkVoxelID(voxelID);
+	return isSolid(voxelID/(m_sizeY*m_sizeZ), voxelID/m_sizeZ % m_sizeY, voxelID % m_sizeZ);
+}
+
+std::uint64_t VoxelMap::getColumnMask(const unsigned int x, const unsigned int y, const unsigned int word) const {
+
+	if(x >= m_sizeX || y >= m_sizeY || word >= m_nbColumnWords) {
 
 		throw std::runtime_error("Error: try to acces to an voxel who is outside the world.");
 	}
 
-	return x*m_sizeY*m_sizeZ + y*m_sizeZ + z;
+	return m_occupancy[(x*m_sizeY + y)*m_nbColumnWords + word];
 }
 
-glm::vec3 VoxelMap::getVoxelPosition(const unsigned int voxelID) const {
+unsigned int VoxelMap::getNbColumnWords() const { return m_nbColumnWords; }
+
+const std::uint64_t *VoxelMap::getColumn(const unsigned int x, const unsigned int y) const {
 
-	if(voxelID > m_voxels.size()) {
+	if(x >= m_sizeX || y >= m_sizeY) {
 
 		throw std::runtime_error("Error: try to acces to an voxel who is outside the world.");
 	}
 
+	return m_occupancy.data() + (x*m_sizeY + y)*m_nbColumnWords;
+}
+
+bool VoxelMap::anySolid(const std::array<unsigned int, 3> &min, const std::array<unsigned int, 3> &max) const {
+
+	const unsigned int maxX{std::min(max[0], m_sizeX)}, maxY{std::min(max[1], m_sizeY)}, maxZ{std::min(max[2], m_sizeZ)};
+
+	std::uint64_t solid{0};
+
+	for(unsigned int x{min[0]}; x < maxX; x++) {
+		for(unsigned int y{min[1]}; y < maxY; y++) {
+			for(unsigned int word{min[2]/64}; word*64 < maxZ; word++) {
+
+				solid |= m_occupancy[(x*m_sizeY + y)*m_nbColumnWords + word] & getRangeMask(word, min[2], maxZ);
+			}
+		}
+	}
+
+	return solid != 0;
+}
+
+unsigned int VoxelMap::getPaletteIndex(const unsigned int x, const unsigned int y, const unsigned int z) const {
+
+	if(x >= m_sizeX || y >= m_sizeY || z >= m_sizeZ) {
+
+		throw std::runtime_error("Error: try to acces to an voxel who is outside the world.");
+	}
+
+	return getIndex(x, y, z);
+}
+
+unsigned int VoxelMap::getPaletteIndex(const unsigned int voxelID) const {
+
+	checkVoxelID(voxelID);
+	return getIndex(voxelID/(m_sizeY*m_sizeZ), voxelID/m_sizeZ % m_sizeY, voxelID % m_sizeZ);
+}
+
+const std::vector<glm::vec4> &VoxelMap::getPalette() const { return m_palette; }
+
+glm::vec3 VoxelMap::getVoxelPosition(const unsigned int voxelID) const {
+
+	checkVoxelID(voxelID);
+
 	return glm::vec3{voxelID/(m_sizeY*m_sizeZ) % m_sizeX, voxelID/m_sizeZ % m_sizeY, voxelID % m_sizeZ};
 }
 
@@ -95,3 +235,201 @@ std::vector<unsigned int> VoxelMap::explode(unsigned int x,unsigned int y, unsig
 	}
 	return v;
 }
+
+size_t VoxelMap::getNbChunks() const { return m_chunks.size(); }
+
+const VoxelChunk &VoxelMap::getChunk(const unsigned int chunk) const {
+
+	checkChunk(chunk);
+	return m_chunks[chunk];
+}
+
+unsigned int VoxelMap::getChunkOfVoxel(const unsigned int voxelID) const {
+
+	checkVoxelID(voxelID);
+	return getChunkIndex(voxelID/(m_sizeY*m_sizeZ), voxelID/m_sizeZ % m_sizeY, voxelID % m_sizeZ);
+}
+
+unsigned int VoxelMap::getLocalVoxel(const unsigned int voxelID) const {
+
+	checkVoxelID(voxelID);
+
+	const unsigned int x{voxelID/(m_sizeY*m_sizeZ)}, y{voxelID/m_sizeZ % m_sizeY}, z{voxelID % m_sizeZ};
+	return ((x % ChunkSize)*ChunkSize + y % ChunkSize)*ChunkSize + z % ChunkSize;
+}
+
+std::vector<unsigned int> VoxelMap::getVoxelsOfChunk(const unsigned int chunk) const {
+
+	checkChunk(chunk);
+
+	const std::array<unsigned int, 3> &origin{m_chunks[chunk].origin};
+	const unsigned int maxX{std::min(origin[0] + ChunkSize, m_sizeX)};
+	const unsigned int maxY{std::min(origin[1] + ChunkSize, m_sizeY)};
+	const unsigned int maxZ{std::min(origin[2] + ChunkSize, m_sizeZ)};
+
+	std::vector<unsigned int> voxels;
+	voxels.reserve((maxX - origin[0])*(maxY - origin[1])*(maxZ - origin[2]));
+
+	for(unsigned int x{origin[0]}; x < maxX; x++) {
+		for(unsigned int y{origin[1]}; y < maxY; y++) {
+			for(unsigned int z{origin[2]}; z < maxZ; z++) { voxels.emplace_back(x*m_sizeY*m_sizeZ + y*m_sizeZ + z); }
+		}
+	}
+
+	return voxels;
+}
+
+void VoxelMap::setChunkMeshEntity(const unsigned int chunk, const Gg::Entity entity) {
+
+	checkChunk(chunk);
+	m_chunks[chunk].meshEntity = entity;
+}
+
+VoxelFaceIndex &VoxelMap::getChunkFaces(const unsigned int chunk) {
+
+	checkChunk(chunk);
+	return m_chunks[chunk].faces;
+}
+
+void VoxelMap::setChunkMeshing(const unsigned int chunk, const VoxelMeshing meshing) {
+
+	checkChunk(chunk);
+
+	if(m_chunks[chunk].meshing == meshing) { return; }
+
+	m_chunks[chunk].meshing = meshing;
+	m_chunks[chunk].needFullMesh = true;
+	m_chunks[chunk].editedVoxels.clear();
+}
+
+VoxelMeshing VoxelMap::getChunkMeshing(const unsigned int chunk) const {
+
+	checkChunk(chunk);
+	return m_chunks[chunk].meshing;
+}
+
+bool VoxelMap::chunkIsDirty(const unsigned int chunk) const {
+
+	checkChunk(chunk);
+	return m_chunks[chunk].needFullMesh || !m_chunks[chunk].editedVoxels.empty();
+}
+
+std::vector<unsigned int> VoxelMap::getDirtyChunks() const {
+
+	std::vector<unsigned int> dirtyChunks;
+
+	for(unsigned int i{0}; i < m_chunks.size(); i++) {
+
+		if(m_chunks[i].needFullMesh || !m_chunks[i].editedVoxels.empty()) { dirtyChunks.emplace_back(i); }
+	}
+
+	return dirtyChunks;
+}
+
+std::vector<unsigned int> VoxelMap::takeEditedVoxels(const unsigned int chunk) {
+
+	checkChunk(chunk);
+
+	std::vector<unsigned int> editedVoxels;
+	editedVoxels.swap(m_chunks[chunk].editedVoxels);
+
+	std::sort(editedVoxels.begin(), editedVoxels.end());
+	editedVoxels.erase(std::unique(editedVoxels.begin(), editedVoxels.end()), editedVoxels.end());
+
+	return editedVoxels;
+}
+
+void VoxelMap::setChunkMeshed(const unsigned int chunk) {
+
+	checkChunk(chunk);
+
+	m_chunks[chunk].needFullMesh = false;
+	m_chunks[chunk].editedVoxels.clear();
+	m_chunks[chunk].meshVersion++;
+}
+
+unsigned int VoxelMap::getIndex(const unsigned int x, const unsigned int y, const unsigned int z) const {
+
+	const VoxelChunk &chunk{m_chunks[getChunkIndex(x, y, z)]};
+
+	if(m_useWideIndices) { return chunk.wideIndices.empty() ? 0 : chunk.wideIndices[getStorageIndex(chunk, x, y, z)]; }
+	return chunk.indices.empty() ? 0 : chunk.indices[getStorageIndex(chunk, x, y, z)];
+}
+
+unsigned int VoxelMap::getChunkIndex(const unsigned int x, const unsigned int y, const unsigned int z) const {
+
+	return ((x/ChunkSize)*m_nbChunks[1] + y/ChunkSize)*m_nbChunks[2] + z/ChunkSize;
+}
+
+unsigned int VoxelMap::getStorageIndex(const VoxelChunk &chunk, const unsigned int x, const unsigned int y, const unsigned int z) const {
+
+	return ((x - chunk.origin[0])*chunk.size[1] + y - chunk.origin[1])*chunk.size[2] + z - chunk.origin[2];
+}
+
+void VoxelMap::recordEdit(const unsigned int x, const unsigned int y, const unsigned int z) {
+
+	VoxelChunk &chunk{m_chunks[getChunkIndex(x, y, z)]};
+
+	if(chunk.meshing == VoxelMeshing::Greedy) { chunk.needFullMesh = true; }
+	else if(!chunk.needFullMesh) { chunk.editedVoxels.emplace_back(x*m_sizeY*m_sizeZ + y*m_sizeZ + z); }
+}
+
+std::uint64_t VoxelMap::getRangeMask(const unsigned int word, const unsigned int minZ, const unsigned int maxZ) {
+
+	// Bits of [minZ, maxZ) that belong to the word
+
+	const unsigned int first{std::max(minZ, word*64) - word*64};
+	const unsigned int last{std::min(maxZ, word*64 + 64) - word*64};
+
+	if(first >= last) { return 0; }
+
+	const std::uint64_t belowLast{last == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << last) - 1};
+	const std::uint64_t belowFirst{(std::uint64_t{1} << first) - 1};
+
+	return belowLast & ~belowFirst;
+}
+
+unsigned int VoxelMap::findOrAddColor(const glm::vec4 &color) {
+
+	const std::array<float, 4> key{color[0], color[1], color[2], color[3]};
+
+	std::map<std::array<float, 4>, unsigned int>::const_iterator found{m_paletteIndices.find(key)};
+	if(found != m_paletteIndices.end()) { return found->second; }
+
+	if(m_palette.size() == MaxPaletteSize) { throw std::runtime_error("Gulg error: too many different colors in the voxel map palette."); }
+
+	// The 8 bits indices can't address a 257th color
+
+	if(!m_useWideIndices && m_palette.size() == 256) {
+
+		for(VoxelChunk &chunk: m_chunks) {
+
+			chunk.wideIndices.assign(chunk.indices.begin(), chunk.indices.end());
+			chunk.indices.clear();
+			chunk.indices.shrink_to_fit();
+		}
+
+		m_useWideIndices = true;
+	}
+
+	const unsigned int index{static_cast<unsigned int>(m_palette.size())};
+
+	m_palette.emplace_back(color);
+	m_paletteIsSolid.emplace_back(color[3] != 0.f);
+	m_paletteIndices.emplace(key, index);
+
+	return index;
+}
+
+void VoxelMap::checkVoxelID(const unsigned int voxelID) const {
+
+	if(voxelID >= m_sizeX*m_sizeY*m_sizeZ) {
+
+		throw std::runtime_error("Error: try to acces to an voxel who is outside the world.");
+	}
+}
+
+void VoxelMap::checkChunk(const unsigned int chunk) const {
+
+	if(chunk >= m_chunks.size()) { throw std::runtime_error("Gulg error: try to access a chunk which is outside the voxel map."); }
+}
@@ -0,0 +1,88 @@
+#include "GulgEngine/CommandBuffer.hpp"
+
+namespace Gg {
+
+CommandBuffer::CommandBuffer(EntityCreator &entityCreator): m_entityCreator{entityCreator} {}
+
+Entity CommandBuffer::createEntity() {
+
+	const Entity newEntity{m_entityCreator.createEntity()};
+	record(CommandType::CreateEntity, newEntity, 0, nullptr);
+
+	return newEntity;
+}
+
+std::vector<Entity> CommandBuffer::createEntities(const unsigned int nbEntities) {
+
+	std::vector<Entity> newEntities{m_entityCreator.createEntities(nbEntities)};
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+	for(Entity newEntity: newEntities) { m_commands.emplace_back(Command{CommandType::CreateEntity, newEntity, 0, nullptr, m_commands.size()}); }
+
+	return newEntities;
+}
+
+void CommandBuffer::addComponent(const Entity entity, const ComponentID id, std::shared_ptr<Component::AbstractComponent> component) {
+
+	record(CommandType::AddComponent, entity, id, std::move(component));
+}
+
+void CommandBuffer::deleteComponent(const Entity entity, const ComponentID id) { record(CommandType::DeleteComponent, entity, id, nullptr); }
+
+void CommandBuffer::deleteEntity(const Entity entity) { record(CommandType::DeleteEntity, entity, 0, nullptr); }
+
+std::vector<Entity> CommandBuffer::instantiate(const Prefab &prefab, const unsigned int nbEntities, const PrefabInit &init) {
+
+	PrefabBatch batch{makePrefabBatch(prefab, m_entityCreator.createEntities(nbEntities), init)};
+	std::vector<Entity> newEntities{batch.entities};
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+	m_prefabBatches.emplace_back(std::move(batch));
+
+	return newEntities;
+}
+
+std::vector<Command> CommandBuffer::takeCommands() {
+
+	std::vector<Command> commands;
+
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+		commands.swap(m_commands);
+	}
+
+	std::sort(commands.begin(), commands.end(), [](const Command &first, const Command &second) {
+
+		const bool firstIsCreation{first.type == CommandType::CreateEntity}, secondIsCreation{second.type == CommandType::CreateEntity};
+
+		if(firstIsCreation != secondIsCreation) { return firstIsCreation; }
+		if(first.entity != second.entity) { return first.entity < second.entity; }
+		return first.order < second.order;
+	});
+
+	return commands;
+}
+
+std::vector<PrefabBatch> CommandBuffer::takePrefabBatches() {
+
+	std::vector<PrefabBatch> batches;
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+	batches.swap(m_prefabBatches);
+
+	return batches;
+}
+
+bool CommandBuffer::empty() const {
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+	return m_commands.empty() && m_prefabBatches.empty();
+}
+
+void CommandBuffer::record(const CommandType type, const Entity entity, const ComponentID id, std::shared_ptr<Component::AbstractComponent> component) {
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+	m_commands.emplace_back(Command{type, entity, id, std::move(component), m_commands.size()});
+}
+
+}
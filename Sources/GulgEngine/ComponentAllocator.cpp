@@ -0,0 +1,82 @@
+#include "GulgEngine/ComponentAllocator.hpp"
+
+#include <algorithm>
+
+namespace Gg {
+
+namespace {
+
+	std::atomic<size_t> componentAllocations{0}, componentDeallocations{0}, heapAllocations{0};
+
+	size_t alignedSize(const size_t size, const size_t alignment) { return ((size + alignment - 1)/alignment)*alignment; }
+}
+
+BlockPool::BlockPool(const size_t blockSize, const size_t blockAlignment):
+	m_blockSize{alignedSize(std::max(blockSize, sizeof(FreeBlock)), std::max(blockAlignment, alignof(FreeBlock)))},
+	m_freeBlocks{nullptr} {}
+
+void *BlockPool::allocate() {
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+
+	const bool fromHeap{m_freeBlocks == nullptr};
+	if(fromHeap) { addChunk(); }
+
+	FreeBlock *block{m_freeBlocks};
+	m_freeBlocks = block->next;
+
+	Allocation::countAllocation(fromHeap);
+	return block;
+}
+
+void BlockPool::deallocate(void *block) {
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+
+	FreeBlock *freeBlock{static_cast<FreeBlock*>(block)};
+	freeBlock->next = m_freeBlocks;
+	m_freeBlocks = freeBlock;
+}
+
+void BlockPool::addChunk() {
+
+	// new[] gives memory aligned for any fundamental type, m_blockSize keeps every block aligned
+
+	m_chunks.emplace_back(std::make_unique<unsigned char[]>(m_blockSize*BlocksPerChunk));
+	unsigned char *chunk{m_chunks.back().get()};
+
+	for(size_t i{BlocksPerChunk}; i > 0; i--) {
+
+		FreeBlock *block{reinterpret_cast<FreeBlock*>(chunk + (i - 1)*m_blockSize)};
+		block->next = m_freeBlocks;
+		m_freeBlocks = block;
+	}
+}
+
+AllocationCounters AllocationCounters::operator-(const AllocationCounters &second) const {
+
+	return AllocationCounters{
+
+		componentAllocations - second.componentAllocations,
+		componentDeallocations - second.componentDeallocations,
+		heapAllocations - second.heapAllocations
+	};
+}
+
+AllocationCounters getAllocationCounters() {
+
+	return AllocationCounters{componentAllocations.load(), componentDeallocations.load(), heapAllocations.load()};
+}
+
+namespace Allocation {
+
+	void countAllocation(const bool fromHeap) {
+
+		componentAllocations.fetch_add(1, std::memory_order_relaxed);
+		if(fromHeap) { heapAllocations.fetch_add(1, std::memory_order_relaxed); }
+	}
+
+	void countDeallocation() { componentDeallocations.fetch_add(1, std::memory_order_relaxed); }
+}
+
+}
@@ -0,0 +1,66 @@
+#include "GulgEngine/ComponentPool.hpp"
+
+namespace Gg {
+
+ComponentPool::ComponentPool() {}
+
+void ComponentPool::add(const Entity entity, std::shared_ptr<Component::AbstractComponent> newComponent) {
+
+	const unsigned int entityIndex{getEntityIndex(entity)};
+
+	if(entityIndex < m_sparse.size() && m_sparse[entityIndex] != NoIndex) {
+
+		// Slot still used by an older generation of this index, the component is replaced
+
+		m_entities[m_sparse[entityIndex]] = entity;
+		m_components[m_sparse[entityIndex]] = newComponent;
+	}
+
+	else {
+
+		if(entityIndex >= m_sparse.size()) { m_sparse.resize(entityIndex + 1, NoIndex); }
+
+		m_sparse[entityIndex] = static_cast<unsigned int>(m_entities.size());
+		m_entities.emplace_back(entity);
+		m_components.emplace_back(newComponent);
+	}
+}
+
+void ComponentPool::remove(const Entity entity) {
+
+	if(has(entity)) {
+
+		const unsigned int index{m_sparse[getEntityIndex(entity)]};
+		const Entity lastEntity{m_entities.back()};
+
+		m_entities[index] = lastEntity;
+		m_components[index] = std::move(m_components.back());
+		m_sparse[getEntityIndex(lastEntity)] = index;
+
+		m_entities.pop_back();
+		m_components.pop_back();
+		m_sparse[getEntityIndex(entity)] = NoIndex;
+	}
+}
+
+bool ComponentPool::has(const Entity entity) const {
+
+	const unsigned int entityIndex{getEntityIndex(entity)};
+	return entityIndex < m_sparse.size() && m_sparse[entityIndex] != NoIndex && m_entities[m_sparse[entityIndex]] == entity;
+}
+
+const std::shared_ptr<Component::AbstractComponent> &ComponentPool::get(const Entity entity) const { return m_components[m_sparse[getEntityIndex(entity)]]; }
+
+size_t ComponentPool::size() const { return m_entities.size(); }
+
+void ComponentPool::reserve(const size_t nbComponents) {
+
+	m_entities.reserve(nbComponents);
+	m_components.reserve(nbComponents);
+}
+
+const std::vector<Entity> &ComponentPool::getEntities() const { return m_entities; }
+
+const std::vector<std::shared_ptr<Component::AbstractComponent>> &ComponentPool::getComponents() const { return m_components; }
+
+}
@@ -2,28 +2,97 @@
 
 namespace Gg {
 
-	
-EntityCreator::EntityCreator(): m_nbMaximalEntity{1} {}
-EntityCreator::EntityCreator(const unsigned int entityReserveSize): m_nbMaximalEntity{1} { addToReserve(entityReserveSize); }
+EntityCreator::EntityCreator(): m_generations(1, 0), m_alive(1, false) {}
+EntityCreator::EntityCreator(const unsigned int entityReserveSize): m_generations(1, 0), m_alive(1, false) { addToReserve(entityReserveSize); }
 
 void EntityCreator::addToReserve(const unsigned int entityReserveSize) {
 
-	for(unsigned int i{m_nbMaximalEntity}; i < m_nbMaximalEntity + entityReserveSize; i++) { m_nextEntities.emplace_back(i); }
+	std::lock_guard<std::mutex> lock{m_mutex};
+	reserve(entityReserveSize);
+}
+
+void EntityCreator::reserve(const unsigned int entityReserveSize) {
+
+	const size_t firstIndex{m_generations.size()};
+
+	if(firstIndex + entityReserveSize > EntityIndexMask + size_t{1}) {
 
-	m_nbMaximalEntity += entityReserveSize;
+		throw std::runtime_error("Gulg error: can't create more than " + std::to_string(EntityIndexMask) + " entities.");
+	}
+
+	m_generations.resize(firstIndex + entityReserveSize, 0);
+	m_alive.resize(firstIndex + entityReserveSize, false);
+
+	// Lowest indices on the top of the stack, so they are given first
+
+	m_freeIndices.reserve(m_freeIndices.size() + entityReserveSize);
+	for(size_t i{firstIndex + entityReserveSize}; i > firstIndex; i--) { m_freeIndices.emplace_back(static_cast<unsigned int>(i - 1)); }
 }
 
-void EntityCreator::freeEntity(const Entity freeEntity) { m_nextEntities.emplace_back(freeEntity); }
+void EntityCreator::freeEntity(const Entity freeEntity) {
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+
+	if(entityIsAlive(freeEntity)) {
+
+		const unsigned int index{getEntityIndex(freeEntity)};
+
+		m_alive[index] = false;
+		m_generations[index] = (m_generations[index] + 1) & EntityGenerationMask;
+		m_freeIndices.emplace_back(index);
+	}
+}
 
 Entity EntityCreator::createEntity() {
 
-	if(m_nextEntities.size() == 0) { addToReserve(1); }
+	std::lock_guard<std::mutex> lock{m_mutex};
+
+	if(m_freeIndices.empty()) { reserve(1); }
+
+	const unsigned int index{m_freeIndices.back()};
+	m_freeIndices.pop_back();
+
+	m_alive[index] = true;
+	return makeEntity(index, m_generations[index]);
+}
+
+std::vector<Entity> EntityCreator::createEntities(const unsigned int nbEntities) {
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+
+	if(m_freeIndices.size() < nbEntities) { reserve(static_cast<unsigned int>(nbEntities - m_freeIndices.size())); }
+
+	std::vector<Entity> newEntities(nbEntities);
+
+	for(unsigned int i{0}; i < nbEntities; i++) {
+
+		const unsigned int index{m_freeIndices.back()};
+		m_freeIndices.pop_back();
+
+		m_alive[index] = true;
+		newEntities[i] = makeEntity(index, m_generations[index]);
+	}
+
+	return newEntities;
+}
+
+bool EntityCreator::isAlive(const Entity entity) const {
+
+	// Worker threads can create entities, and so resize the vectors, while others check theirs
+	std::lock_guard<std::mutex> lock{m_mutex};
+	return entityIsAlive(entity);
+}
 
-	Entity newEntity{m_nextEntities.front()};
-	m_nextEntities.pop_front();
-	return newEntity;
+bool EntityCreator::entityIsAlive(const Entity entity) const {
+
+	const unsigned int index{getEntityIndex(entity)};
+	return index < m_generations.size() && m_alive[index] && m_generations[index] == getEntityGeneration(entity);
 }
 
-size_t EntityCreator::nbRemainingEntities() const{ return m_nextEntities.size(); }
+size_t EntityCreator::nbRemainingEntities() const {
+
+	std::lock_guard<std::mutex> lock{m_mutex};
+	return m_freeIndices.size();
+}
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,62 @@
+#include "GulgEngine/EntityQuery.hpp"
+
+namespace Gg {
+
+EntityQuery::EntityQuery() {}
+
+void EntityQuery::setSignature(const Signature &signature) { m_signature = signature; }
+
+const Signature &EntityQuery::getSignature() const { return m_signature; }
+
+void EntityQuery::add(const Entity entity) {
+
+	if(!has(entity)) {
+
+		const unsigned int entityIndex{getEntityIndex(entity)};
+		if(entityIndex >= m_sparse.size()) { m_sparse.resize(entityIndex + 1, NoIndex); }
+
+		m_sparse[entityIndex] = static_cast<unsigned int>(m_entities.size());
+		m_entities.emplace_back(entity);
+	}
+}
+
+void EntityQuery::remove(const Entity entity) {
+
+	if(has(entity)) {
+
+		const unsigned int index{m_sparse[getEntityIndex(entity)]};
+		const Entity lastEntity{m_entities.back()};
+
+		m_entities[index] = lastEntity;
+		m_sparse[getEntityIndex(lastEntity)] = index;
+
+		m_entities.pop_back();
+		m_sparse[getEntityIndex(entity)] = NoIndex;
+	}
+}
+
+void EntityQuery::clear() {
+
+	m_entities.clear();
+	m_sparse.clear();
+}
+
+bool EntityQuery::has(const Entity entity) const {
+
+	const unsigned int entityIndex{getEntityIndex(entity)};
+	return entityIndex < m_sparse.size() && m_sparse[entityIndex] != NoIndex && m_entities[m_sparse[entityIndex]] == entity;
+}
+
+size_t EntityQuery::size() const { return m_entities.size(); }
+
+bool EntityQuery::empty() const { return m_entities.empty(); }
+
+Entity EntityQuery::operator[](const size_t index) const { return m_entities[index]; }
+
+std::vector<Entity>::const_iterator EntityQuery::begin() const { return m_entities.begin(); }
+
+std::vector<Entity>::const_iterator EntityQuery::end() const { return m_entities.end(); }
+
+const std::vector<Entity> &EntityQuery::getEntities() const { return m_entities; }
+
+}
@@ -7,34 +7,46 @@ EntitySignatureKeeper::EntitySignatureKeeper(const size_t signatureSize): m_sign
 void EntitySignatureKeeper::resetSignatures(const size_t signatureSize) { 
 
 	m_signatureSize = signatureSize;
+	m_entities.clear();
 	m_signatures.clear();
 }
 
 void EntitySignatureKeeper::addEntity(const Entity entity) {
 
+	const unsigned int index{getEntityIndex(entity)};
 
-	if(!entityExist(entity)) { m_signatures.insert(std::make_pair(entity, Signature{m_signatureSize})); }
+	if(index >= m_entities.size()) {
+
+		m_entities.resize(index + 1, NoEntity);
+		m_signatures.resize(index + 1, Signature{m_signatureSize});
+	}
+
+	if(m_entities[index] != entity) {
+
+		m_entities[index] = entity;
+		m_signatures[index] = Signature{m_signatureSize};
+	}
 }
 
 void EntitySignatureKeeper::deleteEntity(const Entity entity) {
 
-	if(entityExist(entity)) { m_signatures.erase(m_signatures.find(entity)); }
+	if(entityExist(entity)) { m_entities[getEntityIndex(entity)] = NoEntity; }
 }
 
 bool EntitySignatureKeeper::entityExist(const Entity entity) const {
 
-	if(m_signatures.find(entity) == m_signatures.end()) { return false; }
-	return true;
+	const unsigned int index{getEntityIndex(entity)};
+	return entity != NoEntity && index < m_entities.size() && m_entities[index] == entity;
 }
 
 void EntitySignatureKeeper::addToSignature(const Entity entity, const Signature signature) {
 
-	if(entityExist(entity)) { m_signatures[entity] += signature; }
+	if(entityExist(entity)) { m_signatures[getEntityIndex(entity)] += signature; }
 }
 
 void EntitySignatureKeeper::deleteToSignature(const Entity entity, const Signature signature) {
 
-	if(entityExist(entity)) { m_signatures[entity] -= signature; }
+	if(entityExist(entity)) { m_signatures[getEntityIndex(entity)] -= signature; }
 }
 
 void EntitySignatureKeeper::cloneEntity(const Entity entityToClone, const Entity clone) {
@@ -42,16 +54,17 @@ void EntitySignatureKeeper::cloneEntity(const Entity entityToClone, const Entity
 	if(entityExist(entityToClone)) { 
 
 		addEntity(clone);
-		m_signatures[clone] = m_signatures[entityToClone]; 
+		m_signatures[getEntityIndex(clone)] = m_signatures[getEntityIndex(entityToClone)];
 	}
 }
 		
-Signature EntitySignatureKeeper::getSignature(const Entity entity) const {
+const Signature &EntitySignatureKeeper::getSignature(const Entity entity) const {
 
-	if(entityExist(entity)) { return m_signatures.at(entity); }
+	if(entityExist(entity)) { return m_signatures[getEntityIndex(entity)]; }
 
 	throw std::runtime_error("Gulg error: asked for signature of entity " + std::to_string(entity)  + ", which doesn't exist.");
-	return Signature{};
 }
 
+const std::vector<Entity> &EntitySignatureKeeper::getEntities() const { return m_entities; }
+
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 namespace Gg {
 
-GulgEngine::GulgEngine(): m_signaturesAreLoaded{false} {}
+GulgEngine::GulgEngine(): m_commandBuffer{m_entityCreator}, m_signaturesAreLoaded{false} {}
 
 bool GulgEngine::loadSignatures(const std::string path) {
 
@@ -12,7 +12,21 @@ bool GulgEngine::loadSignatures(const std::string path) {
 		std::cout << "GulgEngine warning: can't load signature file\"" << path << "\"." << std::endl;
 	}
 
-	else { m_entitySignatureKeeper.resetSignatures(m_signatureLoader.getNumberOfSignatures()); }
+	else {
+
+		for(ComponentID id{0}; id < Component::ComponentNames.size(); id++) {
+
+			const std::string name{Component::ComponentNames[id]};
+
+			if(!m_signatureLoader.existingName(name) || m_signatureLoader.getComponentID(name) != id) {
+
+				throw std::runtime_error("Gulg error: component " + name + " should have the id " + std::to_string(id) + " in the signature file \"" + path + "\".");
+			}
+		}
+
+		m_entitySignatureKeeper.resetSignatures(m_signatureLoader.getNumberOfSignatures());
+		m_componentKeeper.resetComponentTypes(m_signatureLoader.getNumberOfSignatures());
+	}
 
 	return m_signaturesAreLoaded;
 }
@@ -23,59 +37,308 @@ Entity GulgEngine::getNewEntity() {
 
 	Entity newEntity{m_entityCreator.createEntity()};
 	m_entitySignatureKeeper.addEntity(newEntity);
-	m_componentKeeper.addEntity(newEntity);
 
 	return newEntity;
 }
 
+std::vector<Entity> GulgEngine::getNewEntities(const unsigned int nbEntities) {
+
+	checkSignatureLoad();
+
+	std::vector<Entity> newEntities{m_entityCreator.createEntities(nbEntities)};
+	for(Entity newEntity: newEntities) { m_entitySignatureKeeper.addEntity(newEntity); }
+
+	return newEntities;
+}
+
 void GulgEngine::deleteEntity(const Entity entity) {
 
 	checkSignatureLoad();
 
+	if(!m_entityCreator.isAlive(entity)) { return; }
+
+	for(EntityQuery *currentQuery: m_queries) { currentQuery->remove(entity); }
+	m_sceneGraph.remove(entity);
+
 	m_entityCreator.freeEntity(entity);
 	m_entitySignatureKeeper.deleteEntity(entity);
 	m_componentKeeper.deleteEntity(entity);
 }
 
-void GulgEngine::addComponentToEntity(const Entity entity, const std::string name, std::shared_ptr<Component::AbstractComponent> component) {
+bool GulgEngine::isAlive(const Entity entity) const { return m_entityCreator.isAlive(entity); }
+
+void GulgEngine::addComponentToEntity(const Entity entity, const ComponentID id, std::shared_ptr<Component::AbstractComponent> component) {
 
 	checkSignatureLoad();
 
-	m_componentKeeper.addComponent(entity, name, component);
-	m_entitySignatureKeeper.addToSignature(entity, m_signatureLoader.getSignature(name));
+	if(!m_entityCreator.isAlive(entity)) {
+
+		std::cout << "Gulg warning: try to add component " << id << " to entity " << entity << ", which doesn't exist. Nothing will append." << std::endl;
+		return;
+	}
+
+	const Signature oldSignature{m_entitySignatureKeeper.getSignature(entity)};
+
+	m_componentKeeper.addComponent(entity, id, component);
+	m_entitySignatureKeeper.addToSignature(entity, m_signatureLoader.getSignatureFromID(id));
+
+	updateQueries(entity, oldSignature);
+}
+
+void GulgEngine::addComponentToEntity(const Entity entity, const std::string name, std::shared_ptr<Component::AbstractComponent> component) {
+
+	addComponentToEntity(entity, getComponentID(name), std::move(component));
 }
 
-void GulgEngine::deleteComponentToEntity(const Entity entity, const std::string name) {
+void GulgEngine::deleteComponentToEntity(const Entity entity, const ComponentID id) {
 
 	checkSignatureLoad();
 
-	m_componentKeeper.deleteComponent(entity, name);
-	m_entitySignatureKeeper.deleteToSignature(entity, m_signatureLoader.getSignature(name));
+	if(!m_entityCreator.isAlive(entity)) { return; }
+
+	const Signature oldSignature{m_entitySignatureKeeper.getSignature(entity)};
+
+	m_componentKeeper.deleteComponent(entity, id);
+	m_entitySignatureKeeper.deleteToSignature(entity, m_signatureLoader.getSignatureFromID(id));
+
+	updateQueries(entity, oldSignature);
 }
 
-bool GulgEngine::entityHasComponent(const Entity entity, const std::string name) {
+void GulgEngine::deleteComponentToEntity(const Entity entity, const std::string name) { deleteComponentToEntity(entity, getComponentID(name)); }
+
+bool GulgEngine::entityHasComponent(const Entity entity, const ComponentID id) const {
 
-	return m_componentKeeper.entityHasComponent(entity, name);
+	checkSignatureLoad();
+	return m_componentKeeper.entityHasComponent(entity, id);
 }
 
-Signature GulgEngine::getEntitySignature(const Entity entity) const {
+bool GulgEngine::entityHasComponent(const Entity entity, const std::string name) const { return entityHasComponent(entity, getComponentID(name)); }
+
+const Signature &GulgEngine::getEntitySignature(const Entity entity) const {
 
 	checkSignatureLoad();
 	return m_entitySignatureKeeper.getSignature(entity);
 }
 
-std::shared_ptr<Component::AbstractComponent> GulgEngine::getComponent(const Entity entity, const std::string name) const {
+const std::shared_ptr<Component::AbstractComponent> &GulgEngine::getComponent(const Entity entity, const ComponentID id) const {
+
+	checkSignatureLoad();
+	return m_componentKeeper.getComponent(entity, id);
+}
+
+const std::shared_ptr<Component::AbstractComponent> &GulgEngine::getComponent(const Entity entity, const std::string name) const { return getComponent(entity, getComponentID(name)); }
+
+const Signature &GulgEngine::getComponentSignature(const ComponentID id) const {
 
 	checkSignatureLoad();
-	return m_componentKeeper.getComponent(entity, name);
+	return m_signatureLoader.getSignatureFromID(id);
+}
+
+const Signature &GulgEngine::getComponentSignature(const std::string name) const { return getComponentSignature(getComponentID(name)); }
+
+ComponentID GulgEngine::getComponentID(const std::string name) const {
+
+	checkSignatureLoad();
+	return m_signatureLoader.getComponentID(name);
+}
+
+void GulgEngine::subscribeQuery(EntityQuery &query) {
+
+	checkSignatureLoad();
+
+	if(std::find(m_queries.begin(), m_queries.end(), &query) == m_queries.end()) { m_queries.emplace_back(&query); }
+
+	query.clear();
+
+	const std::vector<Entity> &entities{m_entitySignatureKeeper.getEntities()};
+	for(size_t i{0}; i < entities.size(); i++) {
+
+		if(entities[i] != NoEntity && m_entitySignatureKeeper.getSignature(entities[i]).contains(query.getSignature())) { query.add(entities[i]); }
+	}
+}
+
+void GulgEngine::unsubscribeQuery(EntityQuery &query) {
+
+	std::vector<EntityQuery*>::iterator it{std::find(m_queries.begin(), m_queries.end(), &query)};
+	if(it != m_queries.end()) { m_queries.erase(it); }
+}
+
+void GulgEngine::updateQueries(const Entity entity, const Signature &oldSignature) {
+
+	const Signature &newSignature{m_entitySignatureKeeper.getSignature(entity)};
+	if(newSignature == oldSignature) { return; }
+
+	for(EntityQuery *currentQuery: m_queries) {
+
+		const bool wasMatching{oldSignature.contains(currentQuery->getSignature())};
+		const bool isMatching{newSignature.contains(currentQuery->getSignature())};
+
+		if(isMatching && !wasMatching) { currentQuery->add(entity); }
+		else if(wasMatching && !isMatching) { currentQuery->remove(entity); }
+	}
+}
+
+void GulgEngine::addPrefab(const std::string name, Prefab prefab) {
+
+	checkSignatureLoad();
+
+	Signature signature{m_signatureLoader.getNumberOfSignatures()};
+	for(size_t i{0}; i < prefab.getNbComponents(); i++) { signature += m_signatureLoader.getSignatureFromID(prefab.getComponentID(i)); }
+	prefab.setSignature(signature);
+
+	if(m_prefabs.find(name) != m_prefabs.end()) { std::cout << "Gulg warning: prefab \"" << name << "\" already exists, it is replaced." << std::endl; }
+	m_prefabs.insert_or_assign(name, std::move(prefab));
 }
 
-Signature GulgEngine::getComponentSignature(const std::string name) const {
+const Prefab &GulgEngine::getPrefab(const std::string name) const {
+
+	std::map<std::string, Prefab>::const_iterator it{m_prefabs.find(name)};
+	if(it != m_prefabs.end()) { return it->second; }
+
+	throw std::runtime_error("Gulg error: asked for prefab \"" + name + "\", which doesn't exist.");
+}
+
+std::vector<Entity> GulgEngine::instantiate(const std::string name, const unsigned int nbEntities, const PrefabInit &init) {
+
+	PrefabBatch batch{makePrefabBatch(getPrefab(name), m_entityCreator.createEntities(nbEntities), init)};
+	addPrefabBatch(batch);
+
+	return batch.entities;
+}
+
+void GulgEngine::addPrefabBatch(PrefabBatch &batch) {
+
+	const Prefab &prefab{*batch.prefab};
+	const size_t nbComponents{prefab.getNbComponents()};
+
+	for(size_t i{0}; i < nbComponents; i++) {
+
+		const ComponentID id{prefab.getComponentID(i)};
+		m_componentKeeper.reserve(id, m_componentKeeper.getPool(id).size() + batch.entities.size());
+	}
+
+	for(size_t i{0}; i < batch.entities.size(); i++) {
+
+		const Entity entity{batch.entities[i]};
+
+		m_entitySignatureKeeper.addEntity(entity);
+		m_entitySignatureKeeper.addToSignature(entity, prefab.getSignature());
+
+		for(size_t j{0}; j < nbComponents; j++) {
+
+			m_componentKeeper.addComponent(entity, prefab.getComponentID(j), std::move(batch.components[i*nbComponents + j]));
+		}
+	}
+
+	// Every instance has the same signature, so the queries to join are found once
+
+	for(EntityQuery *currentQuery: m_queries) {
+
+		if(prefab.getSignature().contains(currentQuery->getSignature())) {
+
+			for(Entity newEntity: batch.entities) { currentQuery->add(newEntity); }
+		}
+	}
+
+	batch.components.clear();
+}
+
+CommandBuffer &GulgEngine::getCommandBuffer() { return m_commandBuffer; }
+
+SceneGraph &GulgEngine::getSceneGraph() { return m_sceneGraph; }
+
+JobSystem &GulgEngine::getJobSystem() { return m_jobSystem; }
+
+void GulgEngine::applyCommands() {
 
 	checkSignatureLoad();
-	return m_signatureLoader.getSignature(name);
+
+	std::vector<PrefabBatch> batches{m_commandBuffer.takePrefabBatches()};
+	const std::vector<Command> commands{m_commandBuffer.takeCommands()};
+
+	m_lastCreatedEntities.clear();
+	m_lastDeletedEntities.clear();
+
+	// Instances come first, so that later commands can change or delete them
+
+	for(PrefabBatch &currentBatch: batches) {
+
+		addPrefabBatch(currentBatch);
+		m_lastCreatedEntities.insert(m_lastCreatedEntities.end(), currentBatch.entities.begin(), currentBatch.entities.end());
+	}
+
+	size_t i{0};
+
+	for(; i < commands.size() && commands[i].type == CommandType::CreateEntity; i++) {
+
+		m_entitySignatureKeeper.addEntity(commands[i].entity);
+		m_lastCreatedEntities.emplace_back(commands[i].entity);
+	}
+
+	// Changes of one entity are next to each other, in record order. Its queries are updated once,
+	// from the signature it had before them.
+
+	while(i < commands.size()) {
+
+		const Entity entity{commands[i].entity};
+		size_t end{i};
+		bool isDeleted{false};
+
+		while(end < commands.size() && commands[end].entity == entity) {
+
+			isDeleted = isDeleted || commands[end].type == CommandType::DeleteEntity;
+			end++;
+		}
+
+		// Components of entities deleted in the same playback are never built
+
+		if(isDeleted) {
+
+			if(m_entityCreator.isAlive(entity)) {
+
+				deleteEntity(entity);
+				m_lastDeletedEntities.emplace_back(entity);
+			}
+		}
+
+		else if(m_entityCreator.isAlive(entity)) {
+
+			const Signature oldSignature{m_entitySignatureKeeper.getSignature(entity)};
+
+			for(size_t j{i}; j < end; j++) {
+
+				if(commands[j].type == CommandType::AddComponent) {
+
+					m_componentKeeper.addComponent(entity, commands[j].component, commands[j].value);
+					m_entitySignatureKeeper.addToSignature(entity, m_signatureLoader.getSignatureFromID(commands[j].component));
+				}
+
+				else {
+
+					m_componentKeeper.deleteComponent(entity, commands[j].component);
+					m_entitySignatureKeeper.deleteToSignature(entity, m_signatureLoader.getSignatureFromID(commands[j].component));
+				}
+			}
+
+			updateQueries(entity, oldSignature);
+		}
+
+		i = end;
+	}
+
+	// Entities created and deleted in the same playback are only reported as deleted
+
+	m_lastCreatedEntities.erase(std::remove_if(m_lastCreatedEntities.begin(), m_lastCreatedEntities.end(), [this](const Entity entity) {
+
+		return !m_entityCreator.isAlive(entity);
+
+	}), m_lastCreatedEntities.end());
 }
 
+const std::vector<Entity> &GulgEngine::getLastCreatedEntities() const { return m_lastCreatedEntities; }
+
+const std::vector<Entity> &GulgEngine::getLastDeletedEntities() const { return m_lastDeletedEntities; }
+
 void GulgEngine::checkSignatureLoad() const {
 
 	if(!m_signaturesAreLoaded) {
@@ -105,9 +368,13 @@ GLuint GulgEngine::getTexture(const std::string name) const { return m_textureKe
 Entity GulgEngine::cloneEntity(const Entity entityToClone) {
 
 	Entity newEntity{getNewEntity()};
+	const Signature oldSignature{m_entitySignatureKeeper.getSignature(newEntity)};
+
 	m_entitySignatureKeeper.addToSignature(newEntity, m_entitySignatureKeeper.getSignature(entityToClone));
 	m_componentKeeper.cloneEntity(entityToClone, newEntity);
 
+	updateQueries(newEntity, oldSignature);
+
 	return newEntity;
 }
 
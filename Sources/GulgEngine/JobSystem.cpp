@@ -0,0 +1,145 @@
+#include "GulgEngine/JobSystem.hpp"
+
+namespace Gg {
+
+namespace {
+
+	thread_local const JobSystem *currentJobSystem{nullptr};
+	thread_local size_t currentQueueIndex{0};
+}
+
+JobCounter::JobCounter(): m_count{0} {}
+
+bool JobCounter::isDone() const { return m_count.load(std::memory_order_acquire) == 0; }
+
+
+
+JobSystem::JobSystem(): JobSystem{std::max(std::thread::hardware_concurrency(), 1u) - 1} {}
+
+JobSystem::JobSystem(const unsigned int nbWorkers): m_nbPendingJobs{0}, m_stop{false} {
+
+	for(unsigned int i{0}; i <= nbWorkers; i++) { m_queues.emplace_back(std::make_unique<Queue>()); }
+
+	m_workers.reserve(nbWorkers);
+	for(unsigned int i{0}; i < nbWorkers; i++) { m_workers.emplace_back(&JobSystem::workerLoop, this, i + 1); }
+}
+
+JobSystem::~JobSystem() {
+
+	{
+		std::lock_guard<std::mutex> lock{m_sleepMutex};
+		m_stop = true;
+	}
+
+	m_sleepCondition.notify_all();
+	for(std::thread &worker: m_workers) { worker.join(); }
+}
+
+void JobSystem::submit(std::function<void()> job) {
+
+	if(m_workers.empty()) { job(); }
+	else { push(Job{std::move(job), nullptr}); }
+}
+
+void JobSystem::submit(std::function<void()> job, JobCounter &counter) {
+
+	if(m_workers.empty()) {
+
+		job();
+		return;
+	}
+
+	counter.m_count.fetch_add(1, std::memory_order_relaxed);
+	push(Job{std::move(job), &counter});
+}
+
+void JobSystem::wait(JobCounter &counter) {
+
+	const size_t queue{currentQueue()};
+
+	while(!counter.isDone()) {
+
+		Job job;
+		if(findJob(queue, job)) { runJob(job); }
+		else { std::this_thread::yield(); }
+	}
+}
+
+unsigned int JobSystem::getNbWorkers() const { return static_cast<unsigned int>(m_workers.size()); }
+
+void JobSystem::push(Job job) {
+
+	Queue &queue{*m_queues[currentQueue()]};
+
+	{
+		std::lock_guard<std::mutex> lock{queue.mutex};
+		queue.jobs.emplace_back(std::move(job));
+	}
+
+	m_nbPendingJobs.fetch_add(1);
+
+	// Taking the lock orders the increment with a worker checking it before going to sleep
+
+	{ std::lock_guard<std::mutex> lock{m_sleepMutex}; }
+	m_sleepCondition.notify_one();
+}
+
+bool JobSystem::findJob(const size_t queue, Job &job) {
+
+	{
+		Queue &ownQueue{*m_queues[queue]};
+		std::lock_guard<std::mutex> lock{ownQueue.mutex};
+
+		if(!ownQueue.jobs.empty()) {
+
+			job = std::move(ownQueue.jobs.back());
+			ownQueue.jobs.pop_back();
+			m_nbPendingJobs.fetch_sub(1);
+			return true;
+		}
+	}
+
+	for(size_t i{1}; i < m_queues.size(); i++) {
+
+		Queue &victim{*m_queues[(queue + i) % m_queues.size()]};
+		std::lock_guard<std::mutex> lock{victim.mutex};
+
+		if(!victim.jobs.empty()) {
+
+			job = std::move(victim.jobs.front());
+			victim.jobs.pop_front();
+			m_nbPendingJobs.fetch_sub(1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void JobSystem::runJob(Job &job) {
+
+	job.function();
+	if(job.counter != nullptr) { job.counter->m_count.fetch_sub(1, std::memory_order_release); }
+}
+
+size_t JobSystem::currentQueue() const { return currentJobSystem == this ? currentQueueIndex : 0; }
+
+void JobSystem::workerLoop(const size_t queue) {
+
+	currentJobSystem = this;
+	currentQueueIndex = queue;
+
+	while(!m_stop) {
+
+		Job job;
+
+		if(findJob(queue, job)) { runJob(job); }
+		else {
+
+			std::unique_lock<std::mutex> lock{m_sleepMutex};
+			m_sleepCondition.wait(lock, [this]() { return m_stop || m_nbPendingJobs > 0; });
+		}
+	}
+}
+
+}
@@ -0,0 +1,88 @@
+#include "GulgEngine/Prefab.hpp"
+
+namespace Gg {
+
+Prefab::Prefab() {}
+
+size_t Prefab::getNbComponents() const { return m_elements.size(); }
+
+ComponentID Prefab::getComponentID(const size_t component) const { return m_elements[component].id; }
+
+std::shared_ptr<Component::AbstractComponent> Prefab::copyComponent(const size_t component) const {
+
+	return m_elements[component].copy(*m_elements[component].prototype);
+}
+
+void Prefab::setSignature(const Signature &signature) { m_signature = signature; }
+
+const Signature &Prefab::getSignature() const { return m_signature; }
+
+void Prefab::addComponent(const ComponentID id, std::shared_ptr<Component::AbstractComponent> prototype, CopyFunction copy) {
+
+	for(Element &currentElement: m_elements) {
+
+		if(currentElement.id == id) {
+
+			std::cout << "Gulg warning: prefab already has component " << id << ", the prototype is replaced." << std::endl;
+			currentElement.prototype = std::move(prototype);
+			currentElement.copy = copy;
+			return;
+		}
+	}
+
+	m_elements.emplace_back(Element{id, std::move(prototype), copy});
+}
+
+
+
+PrefabBatch::PrefabBatch(const Prefab &batchPrefab, std::vector<Entity> batchEntities):
+	prefab{&batchPrefab},
+	entities{std::move(batchEntities)} {}
+
+
+
+PrefabInstance::PrefabInstance(PrefabBatch &batch, const size_t index): m_batch{batch}, m_index{index} {}
+
+size_t PrefabInstance::getIndex() const { return m_index; }
+
+Entity PrefabInstance::getEntity() const { return m_batch.entities[m_index]; }
+
+const std::shared_ptr<Component::AbstractComponent> &PrefabInstance::getComponent(const ComponentID id) const {
+
+	const size_t nbComponents{m_batch.prefab->getNbComponents()};
+
+	for(size_t i{0}; i < nbComponents; i++) {
+
+		if(m_batch.prefab->getComponentID(i) == id) { return m_batch.components[m_index*nbComponents + i]; }
+	}
+
+	throw std::runtime_error("Gulg error: asked prefab instance for component " + std::to_string(id) + ", which isn't in the prefab.");
+}
+
+
+
+PrefabBatch makePrefabBatch(const Prefab &prefab, std::vector<Entity> entities, const PrefabInit &init) {
+
+	PrefabBatch batch{prefab, std::move(entities)};
+
+	const size_t nbComponents{prefab.getNbComponents()};
+	batch.components.reserve(batch.entities.size()*nbComponents);
+
+	for(size_t i{0}; i < batch.entities.size(); i++) {
+
+		for(size_t j{0}; j < nbComponents; j++) { batch.components.emplace_back(prefab.copyComponent(j)); }
+	}
+
+	if(init) {
+
+		for(size_t i{0}; i < batch.entities.size(); i++) {
+
+			PrefabInstance instance{batch, i};
+			init(instance);
+		}
+	}
+
+	return batch;
+}
+
+}
@@ -0,0 +1,187 @@
+#include "GulgEngine/SceneGraph.hpp"
+
+namespace Gg {
+
+SceneGraph::SceneGraph(): m_firstRoot{NoEntity}, m_isFlat{true} {}
+
+void SceneGraph::addRoot(const Entity entity) {
+
+	if(contains(entity)) { unlink(entity); }
+	else { insertNode(entity); }
+
+	link(entity, NoEntity);
+}
+
+void SceneGraph::setParent(const Entity child, const Entity parent) {
+
+	if(parent == NoEntity) { addRoot(child); return; }
+	if(!contains(parent)) { addRoot(parent); }
+
+	if(contains(child)) {
+
+		for(Entity ancestor{parent}; ancestor != NoEntity; ancestor = getNode(ancestor).parent) {
+
+			if(ancestor == child) { throw std::runtime_error("Gulg error: an entity can't be the child of one of its descendants."); }
+		}
+
+		unlink(child);
+	}
+
+	else { insertNode(child); }
+
+	link(child, parent);
+}
+
+void SceneGraph::remove(const Entity entity) {
+
+	if(!contains(entity)) { return; }
+
+	unlink(entity);
+
+	// Children are kept in the scene as roots
+
+	Entity child{getNode(entity).firstChild};
+
+	while(child != NoEntity) {
+
+		const Entity next{getNode(child).nextSibling};
+		link(child, NoEntity);
+		child = next;
+	}
+
+	getNode(entity) = Node{};
+}
+
+bool SceneGraph::contains(const Entity entity) const {
+
+	const unsigned int index{getEntityIndex(entity)};
+	return entity != NoEntity && index < m_nodes.size() && m_nodes[index].entity == entity;
+}
+
+Entity SceneGraph::getParent(const Entity entity) const {
+
+	if(!contains(entity)) { return NoEntity; }
+	return getNode(entity).parent;
+}
+
+std::vector<Entity> SceneGraph::getChildren(const Entity entity) const {
+
+	std::vector<Entity> children;
+	if(!contains(entity)) { return children; }
+
+	for(Entity child{getNode(entity).firstChild}; child != NoEntity; child = getNode(child).nextSibling) { children.emplace_back(child); }
+	return children;
+}
+
+const std::vector<Entity> &SceneGraph::getOrder() {
+
+	if(!m_isFlat) { flatten(); }
+	return m_order;
+}
+
+const std::vector<unsigned int> &SceneGraph::getParentIndices() {
+
+	if(!m_isFlat) { flatten(); }
+	return m_parentIndices;
+}
+
+std::vector<Entity> SceneGraph::takeMovedNodes() {
+
+	std::vector<Entity> movedNodes;
+
+	for(const Entity entity: m_movedNodes) {
+
+		// Nodes removed since are skipped
+		if(contains(entity) && getNode(entity).hasMoved) {
+
+			getNode(entity).hasMoved = false;
+			movedNodes.emplace_back(entity);
+		}
+	}
+
+	m_movedNodes.clear();
+	return movedNodes;
+}
+
+SceneGraph::Node &SceneGraph::getNode(const Entity entity) { return m_nodes[getEntityIndex(entity)]; }
+
+const SceneGraph::Node &SceneGraph::getNode(const Entity entity) const { return m_nodes[getEntityIndex(entity)]; }
+
+SceneGraph::Node &SceneGraph::insertNode(const Entity entity) {
+
+	if(entity == NoEntity) { throw std::runtime_error("Gulg error: can't add NoEntity to the scene graph."); }
+
+	const unsigned int index{getEntityIndex(entity)};
+	if(index >= m_nodes.size()) { m_nodes.resize(index + 1); }
+
+	m_nodes[index] = Node{};
+	m_nodes[index].entity = entity;
+
+	return m_nodes[index];
+}
+
+void SceneGraph::link(const Entity entity, const Entity parent) {
+
+	Entity &first{parent == NoEntity ? m_firstRoot : getNode(parent).firstChild};
+	Node &node{getNode(entity)};
+
+	node.parent = parent;
+	node.previousSibling = NoEntity;
+	node.nextSibling = first;
+
+	if(first != NoEntity) { getNode(first).previousSibling = entity; }
+	first = entity;
+
+	if(!node.hasMoved) {
+
+		node.hasMoved = true;
+		m_movedNodes.emplace_back(entity);
+	}
+
+	m_isFlat = false;
+}
+
+void SceneGraph::unlink(const Entity entity) {
+
+	Node &node{getNode(entity)};
+
+	if(node.previousSibling != NoEntity) { getNode(node.previousSibling).nextSibling = node.nextSibling; }
+	else if(node.parent != NoEntity) { getNode(node.parent).firstChild = node.nextSibling; }
+	else { m_firstRoot = node.nextSibling; }
+
+	if(node.nextSibling != NoEntity) { getNode(node.nextSibling).previousSibling = node.previousSibling; }
+
+	node.parent = NoEntity;
+	node.previousSibling = NoEntity;
+	node.nextSibling = NoEntity;
+
+	m_isFlat = false;
+}
+
+void SceneGraph::flatten() {
+
+	m_order.clear();
+	m_parentIndices.clear();
+	m_stack.clear();
+
+	for(Entity root{m_firstRoot}; root != NoEntity; root = getNode(root).nextSibling) { m_stack.emplace_back(root, NoParent); }
+
+	while(!m_stack.empty()) {
+
+		const std::pair<Entity, unsigned int> current{m_stack.back()};
+		m_stack.pop_back();
+
+		const unsigned int currentIndex{static_cast<unsigned int>(m_order.size())};
+		m_order.emplace_back(current.first);
+		m_parentIndices.emplace_back(current.second);
+
+		for(Entity child{getNode(current.first).firstChild}; child != NoEntity; child = getNode(child).nextSibling) {
+
+			m_stack.emplace_back(child, currentIndex);
+		}
+	}
+
+	m_isFlat = true;
+}
+
+}
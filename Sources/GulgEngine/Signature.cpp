@@ -2,186 +2,135 @@
 
 namespace Gg {
 
-Signature::Signature() {}
+Signature::Signature(): m_words{}, m_size{0} {}
 
-Signature::Signature(const size_t signatureSize) {
+Signature::Signature(const size_t signatureSize): m_words{}, m_size{0} { resize(signatureSize); }
 
-	m_signature.resize(signatureSize);
-	for(size_t i{0}; i < m_signature.size(); i++) { m_signature[i] = false; }
-}
-
-Signature::Signature(const std::vector<bool> sign): m_signature{sign} {}
-
-Signature::Signature(const Signature &second): m_signature{second.m_signature} {}
-
-void Signature::operator=(const Signature &second) { m_signature = second.m_signature; }
-
-bool Signature::operator<(const Signature &second) const {
-
-	if(m_signature.size() != second.m_signature.size()) {
-
-		std::cout << "Gulg warning: try to compare two signatures with differents sizes. Will return false." << std::endl;
-		return false;
-	}
+Signature::Signature(const std::vector<bool> sign): m_words{}, m_size{0} {
 
-	for(size_t i{0}; i < m_signature.size(); i++) { 
-
-		if(m_signature[i] != second.m_signature[i] && m_signature[i] == true) { return false; } // So second.m_signature[i] == false
-	}
-
-	return true;
+	resize(sign.size());
+	for(size_t i{0}; i < sign.size(); i++) { changeBit(i, sign[i]); }
 }
 
-bool Signature::operator>(const Signature &second) const {
-
-	if(m_signature.size() != second.m_signature.size()) {
-
-		std::cout << "Gulg warning: try to compare two signatures with differents sizes. Will return false." << std::endl;
-		return false;
-	}
+Signature::Signature(const Signature &second):
+	m_words{second.m_words},
+	m_extraWords{second.m_extraWords},
+	m_size{second.m_size} {}
 
-	for(size_t i{0}; i < m_signature.size(); i++) { 
+void Signature::operator=(const Signature &second) {
 
-		if(m_signature[i] != second.m_signature[i] && m_signature[i] == false) { return false; } // So second.m_signature[i] == false
-	}
-
-	return true;
+	m_words = second.m_words;
+	m_extraWords = second.m_extraWords;
+	m_size = second.m_size;
 }
 
-bool Signature::operator==(const Signature &second) const {
+bool Signature::operator<(const Signature &second) const { return second.contains(*this); }
 
-	if(m_signature.size() != second.m_signature.size()) {
+bool Signature::operator>(const Signature &second) const { return contains(second); }
 
-		std::cout << "Gulg warning: try to compare two signatures with differents sizes. Will return false." << std::endl;
-		return false;
-	}
+bool Signature::operator==(const Signature &second) const {
 
-	for(size_t i{0}; i < m_signature.size(); i++) { 
+	Word difference{0};
+	for(size_t i{0}; i < InlineWords; i++) { difference |= m_words[i] ^ second.m_words[i]; }
 
-		if(m_signature[i] != second.m_signature[i]) { return false; } 
-	}
+	const size_t nbExtraWords{std::max(m_extraWords.size(), second.m_extraWords.size())};
+	for(size_t i{InlineWords}; i < InlineWords + nbExtraWords; i++) { difference |= getWord(i) ^ second.getWord(i); }
 
-	return true;
+	return difference == 0;
 }
 
 Signature Signature::operator+(const Signature &second) const {
 
-	std::vector<bool> newSignature{m_signature};
-
-	if(m_signature.size() != second.m_signature.size()) {
-
-		std::cout << "Gulg warning: try to add two signatures with differents sizes. Will return empty signature." << std::endl;
-		return Signature{newSignature};
-	}
-
-	for(size_t i{0}; i < m_signature.size(); i++) { newSignature[i] = m_signature[i] | second.m_signature[i]; }
-	return Signature{newSignature};
+	Signature newSignature{*this};
+	newSignature += second;
+	return newSignature;
 }
 
-void Signature::operator+=(const Signature &second) {
-
-	if(m_signature.size() != second.m_signature.size()) {
-
-		std::cout << "Gulg warning: try to add two signatures with differents sizes. Operation is not going to be applied." << std::endl;
-	}
-
-	for(size_t i{0}; i < m_signature.size(); i++) { m_signature[i] = m_signature[i] | second.m_signature[i]; }
-}
+void Signature::operator+=(const Signature &second) { *this |= second; }
 
 Signature Signature::operator-(const Signature &second) const {
 
-	std::vector<bool> newSignature{m_signature};
-
-	if(m_signature.size() != second.m_signature.size()) {
-
-		std::cout << "Gulg warning: try to substract two signatures with differents sizes. Will return empty signature." << std::endl;
-		return Signature{newSignature};
-	}
-
-	for(size_t i{0}; i < m_signature.size(); i++) { 
-
-		if(m_signature[i] == true && m_signature[i] == second.m_signature[i]) { newSignature[i] = false; }
-		else { newSignature[i] = m_signature[i] | second.m_signature[i]; }
-	}
-
-	return Signature{newSignature};
+	Signature newSignature{*this};
+	newSignature -= second;
+	return newSignature;
 }
 
 void Signature::operator-=(const Signature &second) {
 
-	if(m_signature.size() != second.m_signature.size()) {
-
-		std::cout << "Gulg warning: try to substract two signatures with differents sizes. Operation is not going to be applied." << std::endl;
-	}
-
-	for(size_t i{0}; i < m_signature.size(); i++) { 
-
-		if(m_signature[i] == true && second.m_signature[i] == true) { m_signature[i] = false; }
-	}
+	for(size_t i{0}; i < InlineWords; i++) { m_words[i] &= ~second.m_words[i]; }
+	for(size_t i{0}; i < m_extraWords.size(); i++) { m_extraWords[i] &= ~second.getWord(InlineWords + i); }
 }
 
 Signature Signature::operator|(const Signature &second) const {
 
-	std::vector<bool> newSignature{m_signature};
-
-	if(m_signature.size() != second.m_signature.size()) {
+	Signature newSignature{*this};
+	newSignature |= second;
+	return newSignature;
+}
 
-		std::cout << "Gulg warning: try to apply | operator in two signatures with differents sizes. Will return empty signature." << std::endl;
-		return Signature{newSignature};
-	}
+void Signature::operator|=(const Signature &second) {
 
-	for(size_t i{0}; i < m_signature.size(); i++) { newSignature[i] = m_signature[i] | second.m_signature[i]; }
+	if(second.m_size > m_size) { resize(second.m_size); }
 
-	return Signature{newSignature};
+	for(size_t i{0}; i < InlineWords; i++) { m_words[i] |= second.m_words[i]; }
+	for(size_t i{0}; i < second.m_extraWords.size(); i++) { m_extraWords[i] |= second.m_extraWords[i]; }
 }
 
-void Signature::operator|=(const Signature &second) {
+Signature Signature::operator&(const Signature &second) const {
 
-	if(m_signature.size() != second.m_signature.size()) {
+	Signature newSignature{*this};
+	newSignature &= second;
+	return newSignature;
+}
 
-		std::cout << "Gulg warning: try to apply | operator in two signatures with differents sizes. Operation is not going to be applied." << std::endl;
-	}
+void Signature::operator&=(const Signature &second) {
 
-	for(size_t i{0}; i < m_signature.size(); i++) { m_signature[i] = m_signature[i] | second.m_signature[i]; }
+	for(size_t i{0}; i < InlineWords; i++) { m_words[i] &= second.m_words[i]; }
+	for(size_t i{0}; i < m_extraWords.size(); i++) { m_extraWords[i] &= second.getWord(InlineWords + i); }
 }
 
+bool Signature::contains(const Signature &second) const {
 
-Signature Signature::operator&(const Signature &second) const {
+	// Same result as (*this & second) == second, without building a temporary nor branching per word.
 
-	std::vector<bool> newSignature{m_signature};
+	Word missing{0};
+	for(size_t i{0}; i < InlineWords; i++) { missing |= second.m_words[i] & ~m_words[i]; }
+	for(size_t i{0}; i < second.m_extraWords.size(); i++) { missing |= second.m_extraWords[i] & ~getWord(InlineWords + i); }
 
-	if(m_signature.size() != second.m_signature.size()) {
+	return missing == 0;
+}
+
+bool Signature::intersects(const Signature &second) const {
 
-		std::cout << "Gulg warning: try to apply & operator in two signatures with differents sizes. Will return empty signature." << std::endl;
-		return Signature{newSignature};
-	}
+	Word common{0};
+	for(size_t i{0}; i < InlineWords; i++) { common |= m_words[i] & second.m_words[i]; }
 
-	for(size_t i{0}; i < m_signature.size(); i++) { newSignature[i] = m_signature[i] & second.m_signature[i]; }
+	const size_t nbExtraWords{std::min(m_extraWords.size(), second.m_extraWords.size())};
+	for(size_t i{0}; i < nbExtraWords; i++) { common |= m_extraWords[i] & second.m_extraWords[i]; }
 
-	return Signature{newSignature};
+	return common != 0;
 }
 
-void Signature::operator&=(const Signature &second) {
+void Signature::changeBit(const size_t bit, const bool value) {
 
-	if(m_signature.size() != second.m_signature.size()) {
+	if(bit >= m_size) { throw std::runtime_error("Gulg error: try to change bit " + std::to_string(bit) + " of a signature of size " + std::to_string(m_size) + "."); }
 
-		std::cout << "Gulg warning: try to apply & operator in two signatures with differents sizes. Operation is not going to be applied." << std::endl;
-	}
+	const Word mask{Word{1} << (bit % WordBits)};
 
-	for(size_t i{0}; i < m_signature.size(); i++) { m_signature[i] = m_signature[i] & second.m_signature[i]; }
+	if(value) { getWord(bit/WordBits) |= mask; }
+	else { getWord(bit/WordBits) &= ~mask; }
 }
 
+bool Signature::getBit(const size_t bit) const {
 
-void Signature::changeBit(const size_t bit, const bool value) {
-
-	if(bit >= m_signature.size()) { std::cout << "Gulg warning: try to change bit value which is out of bond. Nothing will append." << std::endl; }
-	else { m_signature[bit] = value; }
+	if(bit >= m_size) { return false; }
+	return (getWord(bit/WordBits) >> (bit % WordBits)) & Word{1};
 }
 
 std::string Signature::asString() const {
 
 	std::string result;
-	for(size_t i{0}; i < m_signature.size(); i++) { result += std::to_string(m_signature[i]); }
+	for(size_t i{0}; i < m_size; i++) { result += std::to_string(getBit(i)); }
 	return result;
 }
 
@@ -191,7 +140,27 @@ std::ostream& operator<<(std::ostream &stream, const Signature &sign) {
 	return stream;
 }
 
-size_t Signature::getSignatureSize() const { return m_signature.size(); }
+size_t Signature::getSignatureSize() const { return m_size; }
+
+void Signature::resize(const size_t signatureSize) {
+
+	const size_t nbWords{(signatureSize + WordBits - 1)/WordBits};
+	if(nbWords > InlineWords) { m_extraWords.resize(nbWords - InlineWords, Word{0}); }
+
+	m_size = signatureSize;
+}
 
+Signature::Word Signature::getWord(const size_t word) const {
 
-}
\ No newline at end of file
+	if(word < InlineWords) { return m_words[word]; }
+	if(word - InlineWords < m_extraWords.size()) { return m_extraWords[word - InlineWords]; }
+	return Word{0};
+}
+
+Signature::Word &Signature::getWord(const size_t word) {
+
+	if(word < InlineWords) { return m_words[word]; }
+	return m_extraWords[word - InlineWords];
+}
+
+}
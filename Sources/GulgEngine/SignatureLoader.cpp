@@ -25,11 +25,14 @@ bool SignatureLoader::loadFile(const std::string path) {
 	file.close();
 
 	size_t nbNames{m_signatures.size()}, currentNumber{0};
+	m_signaturesByID.clear();
 
 	for(std::map<std::string, Signature>::iterator it{m_signatures.begin()}; it != m_signatures.end(); it++) {
 
 		it->second = Signature{nbNames};
 		it->second.changeBit(currentNumber, true);
+		m_componentIDs[it->first] = static_cast<ComponentID>(currentNumber);
+		m_signaturesByID.emplace_back(it->second);
 		++currentNumber;
 	}
 
@@ -42,12 +45,26 @@ bool SignatureLoader::existingName(const std::string name) const {
 	return true;
 }
 
-Signature SignatureLoader::getSignature(const std::string name) const {
+const Signature &SignatureLoader::getSignature(const std::string name) const {
 
 	if(existingName(name)) { return m_signatures.at(name); }
 
 	throw std::runtime_error("Gulg error: asked for signature with a name of " + name  + ", which doesn't exist.");
-	return Signature{};
+}
+
+ComponentID SignatureLoader::getComponentID(const std::string name) const {
+
+	std::map<std::string, ComponentID>::const_iterator found{m_componentIDs.find(name)};
+	if(found != m_componentIDs.end()) { return found->second; }
+
+	throw std::runtime_error("Gulg error: asked for component id with a name of " + name  + ", which doesn't exist.");
+}
+
+const Signature &SignatureLoader::getSignatureFromID(const ComponentID id) const {
+
+	if(id < m_signaturesByID.size()) { return m_signaturesByID[id]; }
+
+	throw std::runtime_error("Gulg error: asked for signature with an id of " + std::to_string(id)  + ", which doesn't exist.");
 }
 
 size_t SignatureLoader::getNumberOfSignatures() const { return m_signatures.size(); }
@@ -344,7 +344,7 @@ bool loadAnimation(Gg::GulgEngine &engine, const Gg::Entity entity, const std::s
 	}
 
 
-	std::shared_ptr<Gg::Component::AnimatedMesh> mesh{std::make_shared<Gg::Component::AnimatedMesh>(engine.getProgram("AnimationProgram"), engine.getTexture("RamboTexture"))};
+	std::shared_ptr<Gg::Component::AnimatedMesh> mesh{Gg::makeComponent<Gg::Component::AnimatedMesh>(engine.getProgram("AnimationProgram"), engine.getTexture("RamboTexture"))};
     
 	if(!loadMesh(mesh, file)) {
 		std::cout << "Error with file \"" << path << "\"." << std::endl;
@@ -353,7 +353,7 @@ bool loadAnimation(Gg::GulgEngine &engine, const Gg::Entity entity, const std::s
 
 	else {
 
-		engine.addComponentToEntity(entity, "MainMesh", std::static_pointer_cast<Gg::Component::AbstractComponent>(mesh));
+		engine.addComponentToEntity<Gg::Component::Mesh>(entity, mesh);
 		mesh->reshape();
 	}
 
@@ -187,305 +187,400 @@ std::vector<glm::vec3> generateWorld(VoxelMap &currentMap, const unsigned int in
 	return birdsPositions;
 }
 
-std::vector<std::pair<unsigned int, glm::vec3>> voxelsAndOrientations(const unsigned int voxelMapSize) {
+// Face of a voxel in each direction (+x, -x, +y, -y, +z, -z): for each corner, whether it is on the
+// far side of the voxel on each axis.
 
-	std::vector<std::pair<unsigned int, glm::vec3>> result;
-	result.reserve(voxelMapSize*6);
+struct FaceTable {
 
-	for(unsigned int i{0}; i < voxelMapSize; i++) {
+	std::array<std::array<unsigned int, 3>, 4> corners;
+};
 
-		result.emplace_back(std::make_pair(i, glm::vec3{1.f, 0.f, 0.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{-1.f, 0.f, 0.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{0.f, 1.f, 0.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{0.f, -1.f, 0.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{0.f, 0.f, 1.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{0.f, 0.f, -1.f}));
-	}
+constexpr std::array<FaceTable, 6> FaceTables{{
+	{{{{1, 0, 0}, {1, 1, 0}, {1, 1, 1}, {1, 0, 1}}}},
+	{{{{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 1, 0}}}},
+	{{{{0, 1, 0}, {0, 1, 1}, {1, 1, 1}, {1, 1, 0}}}},
+	{{{{0, 0, 0}, {1, 0, 0}, {1, 0, 1}, {0, 0, 1}}}},
+	{{{{0, 0, 1}, {0, 1, 1}, {1, 1, 1}, {1, 0, 1}}}},
+	{{{{0, 0, 0}, {0, 1, 0}, {1, 1, 0}, {1, 0, 0}}}}
+}};
 
-	return result;
-}
-std::vector<std::pair<unsigned int, glm::vec3>> voxelsAndOrientations(std::vector<unsigned int> v) {
-
-	std::vector<std::pair<unsigned int, glm::vec3>> result;
-	result.reserve(v.size()*6);
-
-	for(unsigned int j{0}; j < v.size(); j++) {
-    unsigned int i = v[j];
-		result.emplace_back(std::make_pair(i, glm::vec3{1.f, 0.f, 0.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{-1.f, 0.f, 0.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{0.f, 1.f, 0.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{0.f, -1.f, 0.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{0.f, 0.f, 1.f}));
-		result.emplace_back(std::make_pair(i, glm::vec3{0.f, 0.f, -1.f}));
+// Vertices of a face covering the voxels from min to max, both included
+std::array<Gg::Component::VoxelVertex, 4> getFaceVertices(const unsigned int direction, const std::array<unsigned int, 3> &min, const std::array<unsigned int, 3> &max, const std::uint32_t color) {
+
+	std::array<Gg::Component::VoxelVertex, 4> vertices;
+
+	for(unsigned int i{0}; i < 4; i++) {
+
+		const std::array<unsigned int, 3> &corner{FaceTables[direction].corners[i]};
+		vertices[i] = Gg::Component::VoxelMesh::packVertex(std::array<unsigned int, 3>{corner[0] ? max[0] + 1 : min[0],
+		                                                                               corner[1] ? max[1] + 1 : min[1],
+		                                                                               corner[2] ? max[2] + 1 : min[2]}, direction, color);
 	}
 
-	return result;
+	return vertices;
 }
-std::vector<std::pair<unsigned int, glm::vec3>> selectVisibleFaces(const VoxelMap &map, const std::vector<std::pair<unsigned int, glm::vec3>> &facesToSelect) {
 
-	std::vector<std::pair<unsigned int, glm::vec3>> result;
-	result.reserve(facesToSelect.size());
+// Writes the visible faces of the voxels of a chunk straight into its mesh. Visibility comes
+// from the face masks of the whole chunk, computed once.
+
+class FaceEmitter {
 
-	glm::vec3 testingFace;
-	std::array<unsigned int, 3> worldSize{map.getWorldDimensions()};
+	public:
 
-	for(const std::pair<unsigned int, glm::vec3> &currentFace: facesToSelect) {
+		FaceEmitter(VoxelMap &map, const unsigned int chunk, Gg::Component::VoxelMesh &mesh):
+			m_map{map}, m_origin{map.getChunk(chunk).origin},
+			m_faceIndex{map.getChunkFaces(chunk)}, m_mesh{mesh} { m_culling.cull(map, chunk); }
 
-		testingFace = map.getVoxelPosition(currentFace.first) + currentFace.second;
+		void emitVoxel(const unsigned int x, const unsigned int y, const unsigned int z) {
 
-		if(map.getColor(currentFace.first) != glm::vec4{0.f, 0.f, 0.f, 0.f}) { // Delete void voxel
+			emitLocalVoxel(std::array<unsigned int, 3>{x - m_origin[0], y - m_origin[1], z - m_origin[2]});
+		}
+
+		// In x, y then z order
+		void emitChunk() {
+
+			for(unsigned int x{0}; x < VoxelMap::ChunkSize; x++) {
+				for(unsigned int y{0}; y < VoxelMap::ChunkSize; y++) {
+
+					std::uint32_t voxels{m_culling.getAllFaces(x, y)};
 
-			//Out of bounds, have to draw it
-			if(testingFace.x < 0.f || testingFace.x >= worldSize[0]
-			|| testingFace.y < 0.f || testingFace.y >= worldSize[1]
-			|| testingFace.z < 0.f || testingFace.z >= worldSize[2]) {
+					while(voxels != 0) {
 
-				result.emplace_back(currentFace);
+						emitLocalVoxel(std::array<unsigned int, 3>{x, y, static_cast<unsigned int>(__builtin_ctz(voxels))});
+						voxels &= voxels - 1;
+					}
+				}
 			}
+		}
 
-			//No neighbourg
-			else if(map.getColor(testingFace.x, testingFace.y, testingFace.z) == glm::vec4{0.f, 0.f, 0.f, 0.f}) {
+		size_t countFaces() const {
 
-				result.emplace_back(currentFace);
+			size_t nbFaces{0};
+
+			for(unsigned int direction{0}; direction < 6; direction++) {
+				for(unsigned int x{0}; x < VoxelMap::ChunkSize; x++) {
+					for(unsigned int y{0}; y < VoxelMap::ChunkSize; y++) { nbFaces += __builtin_popcount(m_culling.getFaces(direction, x, y)); }
+				}
 			}
+
+			return nbFaces;
 		}
-	}
 
-	return result;
+	private:
+
+		void emitLocalVoxel(const std::array<unsigned int, 3> &local) {
+
+			if(((m_culling.getAllFaces(local[0], local[1]) >> local[2]) & 1u) == 0) { return; }
+
+			const unsigned int localVoxel{(local[0]*VoxelMap::ChunkSize + local[1])*VoxelMap::ChunkSize + local[2]};
+			const std::uint32_t color{Gg::Component::VoxelMesh::packColor(glm::vec3{m_map.getPalette()[m_map.getPaletteIndex(m_origin[0] + local[0], m_origin[1] + local[1], m_origin[2] + local[2])]})};
+
+			for(unsigned int direction{0}; direction < 6; direction++) {
+
+				if(((m_culling.getFaces(direction, local[0], local[1]) >> local[2]) & 1u) == 0) { continue; }
+
+				m_faceIndex.insert(localVoxel, direction, m_mesh.addFace(getFaceVertices(direction, local, local, color)));
+			}
+		}
+
+		VoxelMap &m_map;
+		const std::array<unsigned int, 3> m_origin;
+		VoxelFaceIndex &m_faceIndex;
+		Gg::Component::VoxelMesh &m_mesh;
+		VoxelFaceCulling m_culling;
+};
+
+void localRemeshing(const std::vector<unsigned int> &voxels, VoxelMap &map, const unsigned int chunk, Gg::Component::VoxelMesh &mesh){
+  VoxelFaceIndex &faceIndex{map.getChunkFaces(chunk)};
+  for(unsigned int idV: voxels){
+    const unsigned int localVoxel{map.getLocalVoxel(idV)};
+    for(unsigned int direction{0};direction<6;direction++){
+      unsigned int ind = faceIndex.erase(localVoxel, direction);
+      if(ind == VoxelFaceIndex::NoFace) continue;
+      //Hiding old vertex
+      mesh.hideFace(ind);
+    }
+  }
+
+  const std::array<unsigned int, 3> worldSize{map.getWorldDimensions()};
+  FaceEmitter emitter{map, chunk, mesh};
+
+  for(unsigned int idV: voxels){
+    emitter.emitVoxel(idV/(worldSize[1]*worldSize[2]), idV/worldSize[2] % worldSize[1], idV % worldSize[2]);
+  }
 }
 
-std::array<unsigned int, 4> getPointsOfOrientedFace(const glm::vec3 &orientation) {
+void worldMapToMesh(VoxelMap &map, const unsigned int chunk, Gg::Component::VoxelMesh &mesh) {
 
-	std::array<unsigned int, 4>  quad;
+	mesh.clear();
+	map.getChunkFaces(chunk).clear();
 
-	if(orientation[0] == 1.f) {  quad[0] = 1; quad[1] = 5; quad[2] = 6; quad[3] = 2; }
-	if(orientation[0] == -1.f) { quad[0] = 0; quad[1] = 3; quad[2] = 7; quad[3] = 4; }
-	if(orientation[1] == 1.f) {  quad[0] = 4; quad[1] = 7; quad[2] = 6; quad[3] = 5; }
-	if(orientation[1] == -1.f) { quad[0] = 0; quad[1] = 1; quad[2] = 2; quad[3] = 3; }
-	if(orientation[2] == 1.f) {  quad[0] = 3; quad[1] = 7; quad[2] = 6; quad[3] = 2; }
-	if(orientation[2] == -1.f) { quad[0] = 0; quad[1] = 4; quad[2] = 5; quad[3] = 1; }
+	FaceEmitter emitter{map, chunk, mesh};
 
+	// Counting first lets the buffers be allocated once, at their final size and index width
 
-	return quad;
+	mesh.reserveFaces(emitter.countFaces());
+	emitter.emitChunk();
 }
 
-std::array<unsigned int, 6> getTrianglesOfOrientedFace(const glm::vec3 &orientation) {
+void greedyWorldMapToMesh(VoxelMap &map, const unsigned int chunk, Gg::Component::VoxelMesh &mesh) {
 
-	std::array<unsigned int, 6> triangle;
+	mesh.clear();
+	map.getChunkFaces(chunk).clear();
 
-	if(orientation[0] == 1.f) {  triangle[0] = 1; triangle[1] = 5; triangle[2] = 2;
-								 triangle[3] = 5; triangle[4] = 6; triangle[5] = 2; }
+	const std::array<unsigned int, 3> &origin{map.getChunk(chunk).origin};
+	const std::array<unsigned int, 3> worldSize{map.getWorldDimensions()};
+	const std::array<unsigned int, 3> extent{std::min(VoxelMap::ChunkSize, worldSize[0] - origin[0]),
+	                                         std::min(VoxelMap::ChunkSize, worldSize[1] - origin[1]),
+	                                         std::min(VoxelMap::ChunkSize, worldSize[2] - origin[2])};
 
-	if(orientation[0] == -1.f) { triangle[0] = 0; triangle[1] = 3; triangle[2] = 4;
-								 triangle[3] = 3; triangle[4] = 7; triangle[5] = 4; }
+	VoxelFaceCulling culling;
+	culling.cull(map, chunk);
 
-	if(orientation[1] == 1.f) {  triangle[0] = 4; triangle[1] = 7; triangle[2] = 5;
-								 triangle[3] = 7; triangle[4] = 6; triangle[5] = 5; }
+	// Palette index of the visible face of each voxel of the slice, 0 without face
+	std::vector<unsigned int> slice(VoxelMap::ChunkSize*VoxelMap::ChunkSize);
 
-	if(orientation[1] == -1.f) { triangle[0] = 0; triangle[1] = 1; triangle[2] = 3;
-								 triangle[3] = 1; triangle[4] = 2; triangle[5] = 3; }
+	for(unsigned int direction{0}; direction < 6; direction++) {
 
-	if(orientation[2] == 1.f) {  triangle[0] = 7; triangle[1] = 4; triangle[2] = 6;
-								 triangle[3] = 4; triangle[4] = 6; triangle[5] = 2; }
+		const unsigned int n{direction/2}, u{(n + 1) % 3}, v{(n + 2) % 3};
 
-	if(orientation[2] == -1.f) { triangle[0] = 0; triangle[1] = 1; triangle[2] = 4;
-								 triangle[3] = 1; triangle[4] = 5; triangle[5] = 4; }
+		for(unsigned int layer{0}; layer < extent[n]; layer++) {
 
+			std::array<unsigned int, 3> local;
+			local[n] = layer;
 
-	return triangle;
-}
+			for(unsigned int i{0}; i < extent[u]; i++) {
+				for(unsigned int j{0}; j < extent[v]; j++) {
+
+					local[u] = i;
+					local[v] = j;
+
+					const bool visible{((culling.getFaces(direction, local[0], local[1]) >> local[2]) & 1u) != 0};
+					slice[i*extent[v] + j] = visible ? map.getPaletteIndex(origin[0] + local[0], origin[1] + local[1], origin[2] + local[2]) : 0;
+				}
+			}
+
+			// Grows each rectangle along v, then along u while the whole row matches
 
-glm::vec3 getPositionOfPoint(const VoxelMap &map, const unsigned int voxelID, const unsigned int point) {
+			for(unsigned int i{0}; i < extent[u]; i++) {
+				for(unsigned int j{0}; j < extent[v];) {
 
-	glm::vec3 centerPosition{map.getVoxelPosition(voxelID)};
+					const unsigned int face{slice[i*extent[v] + j]};
+					if(face == 0) { j++; continue; }
 
-	if(point == 0) { centerPosition += glm::vec3{-0.5f, -0.5f, -0.5f}; }
-	if(point == 1) { centerPosition += glm::vec3{0.5f, -0.5f, -0.5f}; }
-	if(point == 2) { centerPosition += glm::vec3{0.5f, -0.5f, 0.5f}; }
-	if(point == 3) { centerPosition += glm::vec3{-0.5f, -0.5f, 0.5f}; }
-	if(point == 4) { centerPosition += glm::vec3{-0.5f, 0.5f, -0.5f}; }
-	if(point == 5) { centerPosition += glm::vec3{0.5f, 0.5f, -0.5f}; }
-	if(point == 6) { centerPosition += glm::vec3{0.5f, 0.5f, 0.5f}; }
-	if(point == 7) { centerPosition += glm::vec3{-0.5f, 0.5f, 0.5f}; }
+					unsigned int width{1};
+					while(j + width < extent[v] && slice[i*extent[v] + j + width] == face) { width++; }
 
-	return centerPosition;
+					unsigned int height{1};
+					bool rowMatches{true};
+
+					while(i + height < extent[u] && rowMatches) {
+
+						for(unsigned int k{0}; k < width && rowMatches; k++) { rowMatches = slice[(i + height)*extent[v] + j + k] == face; }
+						if(rowMatches) { height++; }
+					}
+
+					for(unsigned int h{0}; h < height; h++) {
+
+						std::fill_n(slice.begin() + (i + h)*extent[v] + j, width, 0);
+					}
+
+					std::array<unsigned int, 3> min, max;
+					min[n] = max[n] = layer;
+					min[u] = i;
+					max[u] = i + height - 1;
+					min[v] = j;
+					max[v] = j + width - 1;
+
+					mesh.addFace(getFaceVertices(direction, min, max, Gg::Component::VoxelMesh::packColor(glm::vec3{map.getPalette()[face]})));
+					j += width;
+				}
+			}
+		}
+	}
 }
 
-glm::vec3 getPositionOfPoint( const unsigned int point) {
+// Whether the merged voxel starting at block, factor voxels wide, is solid. Blocks are aligned
+// on factor, so they are either whole or cut by the far sides of the world.
+bool isMergedVoxelSolid(const VoxelMap &map, const std::array<int, 3> &block, const unsigned int factor) {
+
+	const std::array<unsigned int, 3> worldSize{map.getWorldDimensions()};
+
+	for(unsigned int axis{0}; axis < 3; axis++) {
+
+		if(block[axis] < 0 || static_cast<unsigned int>(block[axis]) >= worldSize[axis]) { return false; }
+	}
+
+	const std::array<unsigned int, 3> min{static_cast<unsigned int>(block[0]), static_cast<unsigned int>(block[1]), static_cast<unsigned int>(block[2])};
+	const std::array<unsigned int, 3> max{std::min(min[0] + factor, worldSize[0]), std::min(min[1] + factor, worldSize[1]), std::min(min[2] + factor, worldSize[2])};
+	const std::uint64_t columnMask{(std::uint64_t{1} << (max[2] - min[2])) - 1};
 
-	glm::vec3 centerPosition;
+	unsigned int nbSolid{0};
 
-	if(point == 0) { centerPosition = glm::vec3{-1.f, -1.f, -1.f}; }
-	if(point == 1) { centerPosition = glm::vec3{1.f, -1.f, -1.f}; }
-	if(point == 2) { centerPosition = glm::vec3{1.f, -1.f, 1.f}; }
-	if(point == 3) { centerPosition = glm::vec3{-1.f, -1.f, 1.f}; }
-	if(point == 4) { centerPosition = glm::vec3{-1.f, 1.f, -1.f}; }
-	if(point == 5) { centerPosition = glm::vec3{1.f, 1.f, -1.f}; }
-	if(point == 6) { centerPosition = glm::vec3{1.f, 1.f, 1.f}; }
-	if(point == 7) { centerPosition = glm::vec3{-1.f, 1.f, 1.f}; }
+	for(unsigned int x{min[0]}; x < max[0]; x++) {
+		for(unsigned int y{min[1]}; y < max[1]; y++) {
 
-	return centerPosition;
+			nbSolid += __builtin_popcountll((map.getColumn(x, y)[min[2]/64] >> (min[2] % 64)) & columnMask);
+		}
+	}
+
+	return nbSolid*2 >= (max[0] - min[0])*(max[1] - min[1])*(max[2] - min[2]);
 }
-void localRemeshing(std::vector<std::vector<unsigned int>> v,VoxelMap &map, Gg::Component::Mesh &mesh){
-  for(unsigned int x{0};x<v.size();x++){
-    for(unsigned int y{0};y<v[x].size();y++){
-      unsigned int idV = v[x][y];
-      for(unsigned int i{0};i<map.idVoxel_vertexInds[idV].size();i++){
-        unsigned int ind =  map.idVoxel_vertexInds[idV][i];
-        //Hiding old vertex
-        mesh.m_vertexPosition[ind*4]=glm::vec3{0.f,0.f,0.f};
-        mesh.m_vertexPosition[ind*4+1]=glm::vec3{0.f,0.f,0.f};
-        mesh.m_vertexPosition[ind*4+2]=glm::vec3{0.f,0.f,0.f};
-        mesh.m_vertexPosition[ind*4+3]=glm::vec3{0.f,0.f,0.f};
-      }
-      map.idVoxel_vertexInds[idV].clear();
-    }
-    std::vector<std::pair<unsigned int, glm::vec3>> allFaces{voxelsAndOrientations(v[x])};
-
-    allFaces = selectVisibleFaces(map, allFaces);
-    unsigned int s_t= mesh.m_vertexPosition.size()/4;
-    mesh.m_vertexPosition.resize(mesh.m_vertexPosition.size() + allFaces.size()*4);
-    mesh.m_vertexNormal.resize(mesh.m_vertexNormal.size() + allFaces.size()*4);
-    mesh.m_vertexColor.resize(mesh.m_vertexColor.size() + allFaces.size()*4);
-    mesh.m_vertexIndice.resize(mesh.m_vertexIndice.size() + allFaces.size()*6);
-    std::array<unsigned int, 4> pointsToAdd;
-    glm::vec3 currentNormal;
-
-    for(unsigned int ii{0};ii<allFaces.size();ii++){
-      unsigned int i = ii+s_t;
-      map.idVoxel_vertexInds[allFaces[ii].first].push_back(i);
-  		pointsToAdd = getPointsOfOrientedFace(allFaces[ii].second);
-
-  		mesh.m_vertexPosition[i*4] = getPositionOfPoint(map, allFaces[ii].first, pointsToAdd[0]);
-  		mesh.m_vertexPosition[i*4 + 1] = getPositionOfPoint(map, allFaces[ii].first, pointsToAdd[1]);
-  		mesh.m_vertexPosition[i*4 + 2] = getPositionOfPoint(map, allFaces[ii].first, pointsToAdd[2]);
-  		mesh.m_vertexPosition[i*4 + 3] = getPositionOfPoint(map, allFaces[ii].first, pointsToAdd[3]);
-
-  		mesh.m_vertexColor[i*4] = map.getColor(allFaces[ii].first);
-  		mesh.m_vertexColor[i*4 + 1] = map.getColor(allFaces[ii].first);
-  		mesh.m_vertexColor[i*4 + 2] = map.getColor(allFaces[ii].first);
-  		mesh.m_vertexColor[i*4 + 3] = map.getColor(allFaces[ii].first);
-
-  		currentNormal = glm::triangleNormal(mesh.m_vertexPosition[i*4],
-  											mesh.m_vertexPosition[i*4 + 1],
-  											mesh.m_vertexPosition[i*4 + 2]);
-
-  		mesh.m_vertexNormal[i*4] = currentNormal;
-  		mesh.m_vertexNormal[i*4 + 1] = currentNormal;
-  		mesh.m_vertexNormal[i*4 + 2] = currentNormal;
-  		mesh.m_vertexNormal[i*4 + 3] = currentNormal;
-
-  		mesh.m_vertexIndice[i*6] = i*4;
-  		mesh.m_vertexIndice[i*6 + 1] = i*4 + 1;
-  		mesh.m_vertexIndice[i*6 + 2] = i*4 + 2;
-
-  		mesh.m_vertexIndice[i*6 + 3] = i*4;
-  		mesh.m_vertexIndice[i*6 + 4] = i*4 + 2;
-  		mesh.m_vertexIndice[i*6 + 5] = i*4 + 3;
-    }
 
-  }
+void levelOfDetailToMesh(const VoxelMap &map, const unsigned int chunk, const unsigned int level, Gg::Component::VoxelMesh &mesh) {
+
+	mesh.clear();
+
+	const unsigned int factor{1u << level}, size{VoxelMap::ChunkSize >> level}, paddedSize{size + 2};
+	const std::array<unsigned int, 3> &origin{map.getChunk(chunk).origin};
+
+	// Merged voxels of the chunk, with a margin of one merged voxel for the faces on its sides
+
+	std::vector<bool> solid(paddedSize*paddedSize*paddedSize);
+
+	for(unsigned int i{0}; i < paddedSize; i++) {
+		for(unsigned int j{0}; j < paddedSize; j++) {
+			for(unsigned int k{0}; k < paddedSize; k++) {
+
+				const std::array<int, 3> block{static_cast<int>(origin[0]) + (static_cast<int>(i) - 1)*static_cast<int>(factor),
+				                               static_cast<int>(origin[1]) + (static_cast<int>(j) - 1)*static_cast<int>(factor),
+				                               static_cast<int>(origin[2]) + (static_cast<int>(k) - 1)*static_cast<int>(factor)};
+
+				solid[(i*paddedSize + j)*paddedSize + k] = isMergedVoxelSolid(map, block, factor);
+			}
+		}
+	}
+
+	const std::array<std::array<int, 3>, 6> steps{{{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}}};
+	std::vector<std::pair<unsigned int, unsigned int>> colorCounts;
+
+	for(unsigned int i{1}; i <= size; i++) {
+		for(unsigned int j{1}; j <= size; j++) {
+			for(unsigned int k{1}; k <= size; k++) {
+
+				if(!solid[(i*paddedSize + j)*paddedSize + k]) { continue; }
+
+				std::array<bool, 6> visible;
+				bool anyVisible{false};
+
+				for(unsigned int direction{0}; direction < 6; direction++) {
+
+					visible[direction] = !solid[((i + steps[direction][0])*paddedSize + j + steps[direction][1])*paddedSize + k + steps[direction][2]];
+					anyVisible = anyVisible || visible[direction];
+				}
+
+				if(!anyVisible) { continue; }
+
+				const std::array<unsigned int, 3> min{(i - 1)*factor, (j - 1)*factor, (k - 1)*factor};
+				const std::array<unsigned int, 3> max{min[0] + factor - 1, min[1] + factor - 1, min[2] + factor - 1};
+
+				// Most common color, the lowest palette index on a tie so the result doesn't depend on the order
+
+				colorCounts.clear();
+
+				map.forEachSolid(std::array<unsigned int, 3>{origin[0] + min[0], origin[1] + min[1], origin[2] + min[2]},
+				                 std::array<unsigned int, 3>{origin[0] + max[0] + 1, origin[1] + max[1] + 1, origin[2] + max[2] + 1},
+				                 [&map, &colorCounts](const unsigned int x, const unsigned int y, const unsigned int z) {
+
+					const unsigned int index{map.getPaletteIndex(x, y, z)};
+					std::vector<std::pair<unsigned int, unsigned int>>::iterator found{std::find_if(colorCounts.begin(), colorCounts.end(),
+					                                                                   [index](const std::pair<unsigned int, unsigned int> &count) { return count.first == index; })};
+
+					if(found == colorCounts.end()) { colorCounts.emplace_back(index, 1); }
+					else { found->second++; }
+				});
+
+				std::pair<unsigned int, unsigned int> majority{0, 0};
+
+				for(const std::pair<unsigned int, unsigned int> &count: colorCounts) {
+
+					if(count.second > majority.second || (count.second == majority.second && count.first < majority.first)) { majority = count; }
+				}
+
+				const std::uint32_t color{Gg::Component::VoxelMesh::packColor(glm::vec3{map.getPalette()[majority.first]})};
+
+				for(unsigned int direction{0}; direction < 6; direction++) {
+
+					if(visible[direction]) { mesh.addFace(getFaceVertices(direction, min, max, color)); }
+				}
+			}
+		}
+	}
 }
-void worldMapToMesh(VoxelMap &map, Gg::Component::Mesh &mesh) {
 
-	mesh.m_vertexPosition.clear();
-	mesh.m_vertexColor.clear();
-	mesh.m_vertexNormal.clear();
-	std::array<unsigned int, 3> worldDimensions{map.getWorldDimensions()};
+VoxelMeshStatistics meshChunks(Gg::JobSystem &jobSystem, VoxelMap &map, const std::vector<std::pair<unsigned int, Gg::Component::VoxelMesh*>> &chunks) {
+
+	VoxelMeshStatistics statistics{static_cast<unsigned int>(chunks.size()), 0, 0, 0, 0};
+
+	// Edited voxels are taken before, so the jobs only touch their own chunk and mesh
+
+	std::vector<std::vector<unsigned int>> editedVoxels(chunks.size());
+
+	for(unsigned int i{0}; i < chunks.size(); i++) {
+
+		statistics.nbVerticesBefore += chunks[i].second->getNbVertices();
+		statistics.nbIndicesBefore += chunks[i].second->getNbIndices();
+
+		if(map.getChunkMeshing(chunks[i].first) == VoxelMeshing::Culled && !map.getChunk(chunks[i].first).needFullMesh) {
+
+			editedVoxels[i] = map.takeEditedVoxels(chunks[i].first);
+		}
+	}
+
+	jobSystem.parallelFor(chunks.size(), 1, [&map, &chunks, &editedVoxels](const size_t begin, const size_t end) {
 
-	std::vector<std::pair<unsigned int, glm::vec3>> allFaces{voxelsAndOrientations(worldDimensions[0]*worldDimensions[1]*worldDimensions[2])};
-	allFaces = selectVisibleFaces(map, allFaces);
+		for(size_t i{begin}; i < end; i++) {
 
-	std::vector<std::pair<unsigned int, unsigned int>> pointsToDrawWithDoublon;
-	pointsToDrawWithDoublon.resize(allFaces.size()*4);
+			const unsigned int chunk{chunks[i].first};
+			Gg::Component::VoxelMesh &mesh{*chunks[i].second};
 
-	std::array<unsigned int, 4> pointsToAdd;
+			if(map.getChunkMeshing(chunk) == VoxelMeshing::Greedy) { greedyWorldMapToMesh(map, chunk, mesh); }
+			else if(map.getChunk(chunk).needFullMesh) { worldMapToMesh(map, chunk, mesh); }
+			else {
 
-	mesh.m_vertexPosition.resize(allFaces.size()*4);
-  mesh.m_vertexNormal.resize(allFaces.size()*4);
-	mesh.m_vertexColor.resize(allFaces.size()*4);
-	mesh.m_vertexIndice.resize(allFaces.size()*6);
+				localRemeshing(editedVoxels[i], map, chunk, mesh);
+				if(mesh.needsCompaction()) { worldMapToMesh(map, chunk, mesh); }
+			}
+		}
+	});
 
-  // std::cout<<allFaces.size()<<std::endl;
-  // std::cout<<worldDimensions[0]*worldDimensions[1]*worldDimensions[2]<<std::endl;
-  // std::cout<<mesh.m_vertexColor.size()<<std::endl;
-	glm::vec3 currentNormal;
+	for(const std::pair<unsigned int, Gg::Component::VoxelMesh*> &chunk: chunks) {
 
-  map.idVoxel_vertexInds.clear();
-  map.idVoxel_vertexInds.resize(worldDimensions[0]*worldDimensions[1]*worldDimensions[2]);
-	for(unsigned int i{0}; i < allFaces.size(); i++) {
+		statistics.nbVerticesAfter += chunk.second->getNbVertices();
+		statistics.nbIndicesAfter += chunk.second->getNbIndices();
 
-    map.idVoxel_vertexInds[allFaces[i].first].push_back(i);
-		pointsToAdd = getPointsOfOrientedFace(allFaces[i].second);
+		map.setChunkMeshed(chunk.first);
+		chunk.second->reshape();
+	}
 
-		mesh.m_vertexPosition[i*4] = getPositionOfPoint(map, allFaces[i].first, pointsToAdd[0]);
-		mesh.m_vertexPosition[i*4 + 1] = getPositionOfPoint(map, allFaces[i].first, pointsToAdd[1]);
-		mesh.m_vertexPosition[i*4 + 2] = getPositionOfPoint(map, allFaces[i].first, pointsToAdd[2]);
-		mesh.m_vertexPosition[i*4 + 3] = getPositionOfPoint(map, allFaces[i].first, pointsToAdd[3]);
+	return statistics;
+}
 
-		mesh.m_vertexColor[i*4] = map.getColor(allFaces[i].first);
-		mesh.m_vertexColor[i*4 + 1] = map.getColor(allFaces[i].first);
-		mesh.m_vertexColor[i*4 + 2] = map.getColor(allFaces[i].first);
-		mesh.m_vertexColor[i*4 + 3] = map.getColor(allFaces[i].first);
+VoxelMeshStatistics remeshVoxelMap(Gg::GulgEngine &engine, VoxelMap &map) {
 
-		currentNormal = glm::triangleNormal(mesh.m_vertexPosition[i*4],
-											mesh.m_vertexPosition[i*4 + 1],
-											mesh.m_vertexPosition[i*4 + 2]);
+	std::vector<std::pair<unsigned int, Gg::Component::VoxelMesh*>> chunks;
 
-		mesh.m_vertexNormal[i*4] = currentNormal;
-		mesh.m_vertexNormal[i*4 + 1] = currentNormal;
-		mesh.m_vertexNormal[i*4 + 2] = currentNormal;
-		mesh.m_vertexNormal[i*4 + 3] = currentNormal;
+	for(unsigned int chunk: map.getDirtyChunks()) {
 
-		mesh.m_vertexIndice[i*6] = i*4;
-		mesh.m_vertexIndice[i*6 + 1] = i*4 + 1;
-		mesh.m_vertexIndice[i*6 + 2] = i*4 + 2;
+		const Gg::Entity meshEntity{map.getChunk(chunk).meshEntity};
+		if(meshEntity == Gg::NoEntity) { continue; }
 
-		mesh.m_vertexIndice[i*6 + 3] = i*4;
-		mesh.m_vertexIndice[i*6 + 4] = i*4 + 2;
-		mesh.m_vertexIndice[i*6 + 5] = i*4 + 3;
+		chunks.emplace_back(chunk, &engine.getComponentAs<Gg::Component::Mesh, Gg::Component::VoxelMesh>(meshEntity));
 	}
+
+	return meshChunks(engine.getJobSystem(), map, chunks);
 }
 
 
-void Cube(std::shared_ptr<Gg::Component::Mesh> mesh,float size,glm::vec3 color){
-  std::vector<std::pair<unsigned int, glm::vec3>> allFaces{voxelsAndOrientations(1)};
-  std::array<unsigned int, 4> pointsToAdd;
-
-	mesh->m_vertexPosition.resize(allFaces.size()*4);
-  mesh->m_vertexNormal.resize(allFaces.size()*4);
-	mesh->m_vertexColor.resize(allFaces.size()*4);
-	mesh->m_vertexIndice.resize(allFaces.size()*6);
-
-	glm::vec3 currentNormal;
-	  for(unsigned int i{0}; i < allFaces.size(); i++) {
-	    pointsToAdd = getPointsOfOrientedFace(allFaces[i].second);
-	    mesh->m_vertexPosition[i*4] = size * getPositionOfPoint(pointsToAdd[0]);
-	    mesh->m_vertexPosition[i*4 + 1] = size * getPositionOfPoint(pointsToAdd[1]);
-	    mesh->m_vertexPosition[i*4 + 2] = size * getPositionOfPoint(pointsToAdd[2]);
-	    mesh->m_vertexPosition[i*4 + 3] = size * getPositionOfPoint(pointsToAdd[3]);
-	    mesh->m_vertexColor[i*4] = color;
-			mesh->m_vertexColor[i*4 + 1] = color;
-			mesh->m_vertexColor[i*4 + 2] = color;
-			mesh->m_vertexColor[i*4 + 3] = color;
-	    currentNormal = glm::triangleNormal(mesh->m_vertexPosition[i*4],
-	                      mesh->m_vertexPosition[i*4 + 1],
-	                      mesh->m_vertexPosition[i*4 + 2]);
-	    mesh->m_vertexNormal[i*4] = currentNormal;
-	    mesh->m_vertexNormal[i*4 + 1] = currentNormal;
-	    mesh->m_vertexNormal[i*4 + 2] = currentNormal;
-	    mesh->m_vertexNormal[i*4 + 3] = currentNormal;
-
-	    mesh->m_vertexIndice[i*6] = i*4;
-	    mesh->m_vertexIndice[i*6 + 1] = i*4 + 1;
-	    mesh->m_vertexIndice[i*6 + 2] = i*4 + 2;
-
-	    mesh->m_vertexIndice[i*6 + 3] = i*4;
-	    mesh->m_vertexIndice[i*6 + 4] = i*4 + 2;
-	    mesh->m_vertexIndice[i*6 + 5] = i*4 + 3;
-	  }
-
-    mesh->reshape();
+void Cube(std::shared_ptr<Gg::Component::VoxelMesh> mesh, glm::vec3 color){
+
+	const std::array<unsigned int, 3> origin{0, 0, 0};
+	const std::uint32_t packedColor{Gg::Component::VoxelMesh::packColor(color)};
+
+	mesh->clear();
+	for(unsigned int direction{0}; direction < 6; direction++) { mesh->addFace(getFaceVertices(direction, origin, origin, packedColor)); }
+
+	mesh->reshape();
 }
 
 std::vector<FMOD::Studio::EventInstance*> generateBirds(std::vector<glm::vec3> birdPosition, FMOD::Studio::EventDescription *birdDescription) {
@@ -521,23 +616,43 @@ std::vector<FMOD::Studio::EventInstance*> generateBirds(std::vector<glm::vec3> b
 
 std::vector<FMOD::Studio::EventInstance*> newMap(Gg::GulgEngine & engine, Gg::Entity &worldID, GLuint program, FMOD::Studio::EventDescription *birdDescription){
 
-	std::shared_ptr<Gg::Component::SceneObject> worldScene{std::make_shared<Gg::Component::SceneObject>()};
-	std::shared_ptr<Gg::Component::Transformation> worldTransformation{std::make_shared<Gg::Component::Transformation>()};
-	std::shared_ptr<Gg::Component::Mesh> worldMesh{std::make_shared<Gg::Component::Mesh>(program)};
-	std::shared_ptr<VoxelMap> worldMap{std::make_shared<VoxelMap>(200, 600, 40)};
+	std::shared_ptr<Gg::Component::SceneObject> worldScene{Gg::makeComponent<Gg::Component::SceneObject>()};
+	std::shared_ptr<Gg::Component::Transformation> worldTransformation{Gg::makeComponent<Gg::Component::Transformation>()};
+	std::shared_ptr<VoxelMap> worldMap{Gg::makeComponent<VoxelMap>(200, 600, 40)};
 
-	engine.addComponentToEntity(worldID, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(worldScene));
-	engine.addComponentToEntity(worldID, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(worldTransformation));
-	engine.addComponentToEntity(worldID, "MainMesh", std::static_pointer_cast<Gg::Component::AbstractComponent>(worldMesh));
-	engine.addComponentToEntity(worldID, "VoxelMap", std::static_pointer_cast<Gg::Component::AbstractComponent>(worldMap));
+	engine.addComponentToEntity(worldID, worldScene);
+	engine.addComponentToEntity(worldID, worldTransformation);
+	engine.addComponentToEntity(worldID, worldMap);
 
 	std::vector<glm::vec3> birds{generateWorld(*worldMap, 4)};
 
 	std::vector<FMOD::Studio::EventInstance*> resultBirds{generateBirds(birds, birdDescription)};
 
-	worldMapToMesh(*worldMap, *worldMesh);
+	// One mesh per chunk, child of the world. Drawing inverts the scene transformations,
+	// so the chunk is moved by -origin to be drawn at +origin.
+
+	std::vector<Gg::Entity> chunkEntities{engine.getNewEntities(worldMap->getNbChunks())};
+
+	for(unsigned int chunk{0}; chunk < worldMap->getNbChunks(); chunk++) {
+
+		std::shared_ptr<Gg::Component::SceneObject> chunkScene{Gg::makeComponent<Gg::Component::SceneObject>()};
+		std::shared_ptr<Gg::Component::Transformation> chunkTransformation{Gg::makeComponent<Gg::Component::Transformation>()};
+		std::shared_ptr<Gg::Component::VoxelMesh> chunkMesh{Gg::makeComponent<Gg::Component::VoxelMesh>(program)};
+		std::shared_ptr<Gg::Component::LevelOfDetail> chunkLevelOfDetail{Gg::makeComponent<Gg::Component::LevelOfDetail>(program)};
+
+		const std::array<unsigned int, 3> &origin{worldMap->getChunk(chunk).origin};
+		chunkTransformation->translate(-glm::vec3{origin[0], origin[1], origin[2]});
+
+		engine.addComponentToEntity(chunkEntities[chunk], chunkScene);
+		engine.addComponentToEntity(chunkEntities[chunk], chunkTransformation);
+		engine.addComponentToEntity<Gg::Component::Mesh>(chunkEntities[chunk], chunkMesh);
+		engine.addComponentToEntity(chunkEntities[chunk], chunkLevelOfDetail);
+
+		engine.getSceneGraph().setParent(chunkEntities[chunk], worldID);
+		worldMap->setChunkMeshEntity(chunk, chunkEntities[chunk]);
+	}
 
-	worldMesh->reshape();
+	remeshVoxelMap(engine, *worldMap);
 
 	return resultBirds;
 }
@@ -3,8 +3,8 @@
 #include "Algorithms/CollisionsResolution.hpp"
 Collisions::Collisions(Gg::GulgEngine &gulgEngine,Gg::Entity &w,FMOD::Studio::EventDescription* s,FMOD::Studio::EventDescription* ss): System{gulgEngine},world{w},explosioneventDescription{s},stepeventDescription{ss} {
 
-	m_algorithms.emplace_back(std::make_unique<Gg::Algorithm::UpdateCollisions>(gulgEngine,w,this));
-	m_algorithms.emplace_back(std::make_unique<Gg::Algorithm::CollisionsResolution>(gulgEngine,w,this));
+	addAlgorithm(std::make_unique<Gg::Algorithm::UpdateCollisions>(gulgEngine,w,this));
+	addAlgorithm(std::make_unique<Gg::Algorithm::CollisionsResolution>(gulgEngine,w,this));
 
 
 }
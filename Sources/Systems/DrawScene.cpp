@@ -5,11 +5,22 @@ DrawScene::DrawScene(Gg::GulgEngine &gulgEngine):
 	m_cameraEntity{Gg::NoEntity},
 	m_projectionMatrix{1.f} {
 
-	m_algorithms.emplace_back(std::make_unique<Gg::Algorithm::DrawMesh>("MainMesh", m_cameraEntity, m_projectionMatrix, gulgEngine));
+	std::unique_ptr<Gg::Algorithm::UpdateLevelOfDetail> updateLevelOfDetail{std::make_unique<Gg::Algorithm::UpdateLevelOfDetail>(m_cameraEntity, gulgEngine)};
+	m_updateLevelOfDetail = updateLevelOfDetail.get();
+
+	std::unique_ptr<Gg::Algorithm::DrawMesh> drawMesh{std::make_unique<Gg::Algorithm::DrawMesh>("MainMesh", m_cameraEntity, m_projectionMatrix, gulgEngine)};
+	m_drawMesh = drawMesh.get();
+
+	addAlgorithm(std::move(updateLevelOfDetail));
+	addAlgorithm(std::move(drawMesh));
 }
 
 DrawScene::~DrawScene() {}
 
 void DrawScene::setCameraEntity(const Gg::Entity camera) { m_cameraEntity = camera; }
 
-void DrawScene::setProjection(const glm::mat4 projection) { m_projectionMatrix = projection; }
\ No newline at end of file
+void DrawScene::setProjection(const glm::mat4 projection) { m_projectionMatrix = projection; }
+
+size_t DrawScene::getUploadedBytes() const { return m_drawMesh->getUploadedBytes(); }
+
+const LevelOfDetailStatistics &DrawScene::getLevelOfDetailStatistics() const { return m_updateLevelOfDetail->getStatistics(); }
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "Systems/Scheduler.hpp"
+
+namespace Gg {
+
+namespace Systems {
+
+Scheduler::Scheduler(JobSystem &jobSystem): m_jobSystem{jobSystem}, m_nbFinishedTasks{0} {}
+
+void Scheduler::addSystem(System &system) { m_steps.emplace_back(Step{&system, nullptr}); }
+
+void Scheduler::addSyncPoint(std::function<void()> syncPoint) { m_steps.emplace_back(Step{nullptr, std::move(syncPoint)}); }
+
+void Scheduler::run() {
+
+	std::vector<Task> tasks;
+
+	for(size_t step{0}; step <= m_steps.size(); step++) {
+
+		if(step == m_steps.size() || m_steps[step].system == nullptr) {
+
+			runTasks(tasks);
+			tasks.clear();
+
+			if(step < m_steps.size()) { m_steps[step].syncPoint(); }
+			continue;
+		}
+
+		// The graph is rebuilt each frame, so algorithms can change their accesses between frames
+
+		const size_t firstOfSystem{tasks.size()};
+
+		for(const std::unique_ptr<Algorithm::AbstractAlgorithm> &algorithm: m_steps[step].system->getAlgorithms()) {
+
+			const size_t current{tasks.size()};
+			tasks.emplace_back(Task{algorithm.get(), {}, 0});
+
+			for(size_t previous{0}; previous < current; previous++) {
+
+				// Main thread only algorithms share the OpenGL state, they keep their order too
+
+				const bool sameSystemPredecessor{previous + 1 == current && previous >= firstOfSystem};
+				const bool bothOnMainThread{tasks[previous].algorithm->isMainThreadOnly() && algorithm->isMainThreadOnly()};
+
+				if(sameSystemPredecessor || bothOnMainThread || tasks[previous].algorithm->conflictsWith(*algorithm)) {
+
+					tasks[previous].successors.emplace_back(current);
+					tasks[current].nbDependencies++;
+				}
+			}
+		}
+	}
+}
+
+void Scheduler::runTasks(std::vector<Task> &tasks) {
+
+	if(tasks.empty()) { return; }
+
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+		m_nbFinishedTasks = 0;
+		m_mainThreadTasks.clear();
+	}
+
+	// Without worker, launching a task runs it at once, so the roots are listed before
+
+	std::vector<size_t> roots;
+
+	for(size_t task{0}; task < tasks.size(); task++) {
+
+		if(tasks[task].nbDependencies == 0) { roots.emplace_back(task); }
+	}
+
+	for(size_t root: roots) { launchTask(tasks, root); }
+
+	while(true) {
+
+		size_t task;
+
+		{
+			std::unique_lock<std::mutex> lock{m_mutex};
+			m_condition.wait(lock, [&]() { return m_nbFinishedTasks == tasks.size() || !m_mainThreadTasks.empty(); });
+
+			if(m_mainThreadTasks.empty()) { return; }
+
+			task = m_mainThreadTasks.back();
+			m_mainThreadTasks.pop_back();
+		}
+
+		tasks[task].algorithm->apply();
+		finishTask(tasks, task);
+	}
+}
+
+void Scheduler::finishTask(std::vector<Task> &tasks, const size_t task) {
+
+	std::vector<size_t> readyTasks;
+
+	{
+		std::lock_guard<std::mutex> lock{m_mutex};
+
+		for(size_t successor: tasks[task].successors) {
+
+			tasks[successor].nbDependencies--;
+			if(tasks[successor].nbDependencies == 0) { readyTasks.emplace_back(successor); }
+		}
+
+		m_nbFinishedTasks++;
+	}
+
+	for(size_t readyTask: readyTasks) { launchTask(tasks, readyTask); }
+
+	m_condition.notify_all();
+}
+
+void Scheduler::launchTask(std::vector<Task> &tasks, const size_t task) {
+
+	if(tasks[task].algorithm->isMainThreadOnly()) {
+
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+			m_mainThreadTasks.emplace_back(task);
+		}
+
+		m_condition.notify_all();
+	}
+
+	else {
+
+		m_jobSystem.submit([this, &tasks, task]() {
+
+			tasks[task].algorithm->apply();
+			finishTask(tasks, task);
+		});
+	}
+}
+
+}}
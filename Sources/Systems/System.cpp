@@ -12,7 +12,7 @@ void System::addEntity(const Entity newEntity) {
 
 	for(std::unique_ptr<Algorithm::AbstractAlgorithm> &currentAlgo: m_algorithms) {
 
-		if((m_gulgEngine.getEntitySignature(newEntity) & currentAlgo->getSignature()) == currentAlgo->getSignature()) {
+		if(m_gulgEngine.getEntitySignature(newEntity).contains(currentAlgo->getSignature())) {
 
 			currentAlgo->addEntity(newEntity);
 		}
@@ -24,9 +24,17 @@ void System::deleteEntity(const Entity newEntity) {
 	for(std::unique_ptr<Algorithm::AbstractAlgorithm> &currentAlgo: m_algorithms) { currentAlgo->deleteEntity(newEntity); }
 }
 
+void System::addAlgorithm(std::unique_ptr<Algorithm::AbstractAlgorithm> algorithm) {
+
+	if(algorithm->wantsSubscription()) { algorithm->subscribe(); }
+	m_algorithms.emplace_back(std::move(algorithm));
+}
+
 void System::applyAlgorithms() {
 
 	for(std::unique_ptr<Algorithm::AbstractAlgorithm> &currentAlgo: m_algorithms) { currentAlgo->apply(); }
 }
 
+const std::vector<std::unique_ptr<Algorithm::AbstractAlgorithm>> &System::getAlgorithms() const { return m_algorithms; }
+
 }}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#include "Systems/Terrain.hpp"
+
+Terrain::Terrain(Gg::GulgEngine &gulgEngine): System{gulgEngine} {
+
+	std::unique_ptr<Gg::Algorithm::UpdateVoxelMeshes> updateVoxelMeshes{std::make_unique<Gg::Algorithm::UpdateVoxelMeshes>(gulgEngine)};
+	m_updateVoxelMeshes = updateVoxelMeshes.get();
+
+	addAlgorithm(std::move(updateVoxelMeshes));
+}
+
+Terrain::~Terrain() {}
+
+unsigned int Terrain::getNbRemeshedChunks() const { return m_updateVoxelMeshes->getNbRemeshedChunks(); }
+
+const VoxelMeshStatistics &Terrain::getMeshStatistics() const { return m_updateVoxelMeshes->getStatistics(); }
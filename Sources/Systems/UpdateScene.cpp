@@ -2,7 +2,12 @@
 
 UpdateScene::UpdateScene(Gg::GulgEngine &gulgEngine): System{gulgEngine} {
 
-	m_algorithms.emplace_back(std::make_unique<Gg::Algorithm::UpdateTransformations>(gulgEngine));
+	std::unique_ptr<Gg::Algorithm::UpdateTransformations> updateTransformations{std::make_unique<Gg::Algorithm::UpdateTransformations>(gulgEngine)};
+	m_updateTransformations = updateTransformations.get();
+
+	addAlgorithm(std::move(updateTransformations));
 }
 
-UpdateScene::~UpdateScene() {}
\ No newline at end of file
+UpdateScene::~UpdateScene() {}
+
+size_t UpdateScene::getNbUpdatedNodes() const { return m_updateTransformations->getNbUpdatedNodes(); }
\ No newline at end of file
@@ -27,6 +27,8 @@
 #include "Systems/DrawScene.hpp"
 #include "Systems/Lightning.hpp"
 #include "Systems/Time.hpp"
+#include "Systems/Terrain.hpp"
+#include "Systems/Scheduler.hpp"
 
 #include "LoadAnimation.hpp"
 #include "NewMap.hpp"
@@ -73,6 +75,41 @@ bool initOpenGL(GLFWwindow **window) {
     return true;
 }
 
+void loadPrefabs(Gg::GulgEngine &engine, const GLuint program) {
+
+    std::shared_ptr<Gg::Component::VoxelMesh> cube{Gg::makeComponent<Gg::Component::VoxelMesh>(program)};
+    Cube(cube,glm::vec3{1.f,0.f,0.f});
+
+    Gg::Prefab grenade;
+    grenade.addComponent(Gg::makeComponent<Gg::Component::SceneObject>());
+    grenade.addComponent(Gg::makeComponent<Gg::Component::Transformation>());
+    grenade.addComponent(Gg::makeComponent<Gg::Component::Collider>());
+    grenade.addComponent(Gg::makeComponent<Gg::Component::Forces>());
+    grenade.addComponentAs<Gg::Component::Mesh>(cube);
+    grenade.addComponent(Gg::makeComponent<Gg::Component::Explosive>(5,TIMER));
+    grenade.addComponent(Gg::makeComponent<Gg::Component::Timer>(5000));
+    engine.addPrefab("Grenade", std::move(grenade));
+
+    Gg::Prefab rocket;
+    rocket.addComponent(Gg::makeComponent<Gg::Component::SceneObject>());
+    rocket.addComponent(Gg::makeComponent<Gg::Component::Transformation>());
+    rocket.addComponent(Gg::makeComponent<Gg::Component::Collider>());
+    rocket.addComponent(Gg::makeComponent<Gg::Component::Forces>(glm::vec3{0.f},0.f,1.f,8.f));
+    rocket.addComponentAs<Gg::Component::Mesh>(cube);
+    rocket.addComponent(Gg::makeComponent<Gg::Component::Explosive>(7,ON_COLLISION));
+    engine.addPrefab("Rocket", std::move(rocket));
+
+    //Color of the voxel it comes from is given at instantiation
+    Gg::Prefab debris;
+    debris.addComponent(Gg::makeComponent<Gg::Component::SceneObject>());
+    debris.addComponent(Gg::makeComponent<Gg::Component::Transformation>());
+    debris.addComponent(Gg::makeComponent<Gg::Component::Collider>());
+    debris.addComponent(Gg::makeComponent<Gg::Component::Forces>(glm::vec3{0.f},0.1f,1.f,2.f));
+    debris.addComponentAs<Gg::Component::Mesh>(cube);
+    debris.addComponent(Gg::makeComponent<Gg::Component::Timer>(5000));
+    engine.addPrefab("Debris", std::move(debris));
+}
+
 int main() {
 
 
@@ -227,6 +264,8 @@ int main() {
 
     GLuint program{engine.getProgram("MainProgram")};
 
+    loadPrefabs(engine, program);
+
     //INITIALISING PLAYER WORLD AND CAMERA //
     Gg::Entity gameID{engine.getNewEntity()},
                worldID{engine.getNewEntity()},
@@ -238,34 +277,34 @@ int main() {
     // newMap(engine,worldID,program,birdDescription);
     std::vector<FMOD::Studio::EventInstance*> birds{newMap(engine,worldID,program, birdDescription)};
 
-    std::shared_ptr<Gg::Component::SceneObject> gameScene{std::make_shared<Gg::Component::SceneObject>()};
-    std::shared_ptr<Gg::Component::SceneObject> cameraScene{std::make_shared<Gg::Component::SceneObject>()};
-    std::shared_ptr<Gg::Component::SceneObject> playerScene{std::make_shared<Gg::Component::SceneObject>()};
-    std::shared_ptr<Gg::Component::SceneObject> meshScene{std::make_shared<Gg::Component::SceneObject>()};
+    std::shared_ptr<Gg::Component::SceneObject> gameScene{Gg::makeComponent<Gg::Component::SceneObject>()};
+    std::shared_ptr<Gg::Component::SceneObject> cameraScene{Gg::makeComponent<Gg::Component::SceneObject>()};
+    std::shared_ptr<Gg::Component::SceneObject> playerScene{Gg::makeComponent<Gg::Component::SceneObject>()};
+    std::shared_ptr<Gg::Component::SceneObject> meshScene{Gg::makeComponent<Gg::Component::SceneObject>()};
 
-    std::shared_ptr<Gg::Component::Transformation> gameTransformation{std::make_shared<Gg::Component::Transformation>()};
-    std::shared_ptr<Gg::Component::Transformation> cameraTransformation{std::make_shared<Gg::Component::Transformation>()};
-    std::shared_ptr<Gg::Component::Transformation> playerTransformation{std::make_shared<Gg::Component::Transformation>()};
-    std::shared_ptr<Gg::Component::Transformation> meshTransformation{std::make_shared<Gg::Component::Transformation>()};
+    std::shared_ptr<Gg::Component::Transformation> gameTransformation{Gg::makeComponent<Gg::Component::Transformation>()};
+    std::shared_ptr<Gg::Component::Transformation> cameraTransformation{Gg::makeComponent<Gg::Component::Transformation>()};
+    std::shared_ptr<Gg::Component::Transformation> playerTransformation{Gg::makeComponent<Gg::Component::Transformation>()};
+    std::shared_ptr<Gg::Component::Transformation> meshTransformation{Gg::makeComponent<Gg::Component::Transformation>()};
 
-    std::shared_ptr<Gg::Component::Collider> playerCollider{std::make_shared<Gg::Component::Collider>(glm::vec3{-0.5f,-0.75f,-1.5f},glm::vec3{2.5f,0.75f,5.5f})};
-      std::shared_ptr<Gg::Component::Forces> playerForces{std::make_shared<Gg::Component::Forces>(glm::vec3{0.f},0.1f,1.f,0.3f) };
-      std::shared_ptr<Gg::Component::StepSound> playerstepSound{std::make_shared<Gg::Component::StepSound>(stepeventInstance)};
+    std::shared_ptr<Gg::Component::Collider> playerCollider{Gg::makeComponent<Gg::Component::Collider>(glm::vec3{-0.5f,-0.75f,-1.5f},glm::vec3{2.5f,0.75f,5.5f})};
+      std::shared_ptr<Gg::Component::Forces> playerForces{Gg::makeComponent<Gg::Component::Forces>(glm::vec3{0.f},0.1f,1.f,0.3f) };
+      std::shared_ptr<Gg::Component::StepSound> playerstepSound{Gg::makeComponent<Gg::Component::StepSound>(stepeventInstance)};
 
 
-    engine.addComponentToEntity(gameID, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(gameScene));
-    engine.addComponentToEntity(cameraID, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(cameraScene));
-    engine.addComponentToEntity(playerID, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(playerScene));
-    engine.addComponentToEntity(meshID, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(meshScene));
+    engine.addComponentToEntity(gameID, gameScene);
+    engine.addComponentToEntity(cameraID, cameraScene);
+    engine.addComponentToEntity(playerID, playerScene);
+    engine.addComponentToEntity(meshID, meshScene);
 
-    engine.addComponentToEntity(gameID, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(gameTransformation));
-    engine.addComponentToEntity(cameraID, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(cameraTransformation));
-    engine.addComponentToEntity(playerID, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(playerTransformation));
-    engine.addComponentToEntity(meshID, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(meshTransformation));
+    engine.addComponentToEntity(gameID, gameTransformation);
+    engine.addComponentToEntity(cameraID, cameraTransformation);
+    engine.addComponentToEntity(playerID, playerTransformation);
+    engine.addComponentToEntity(meshID, meshTransformation);
 
-    engine.addComponentToEntity(playerID, "Collider", std::static_pointer_cast<Gg::Component::AbstractComponent>(playerCollider));
-    engine.addComponentToEntity(playerID, "Forces", std::static_pointer_cast<Gg::Component::AbstractComponent>(playerForces));
-    engine.addComponentToEntity(playerID, "StepSound", std::static_pointer_cast<Gg::Component::AbstractComponent>(playerstepSound));
+    engine.addComponentToEntity(playerID, playerCollider);
+    engine.addComponentToEntity(playerID, playerForces);
+    engine.addComponentToEntity(playerID, playerstepSound);
 
     loadAnimation(engine, meshID, "Datas/Animated/rambo.dae");
     meshTransformation->rotate(glm::radians(180.f), glm::vec3{0.f, 0.f, 1.f});
@@ -273,25 +312,22 @@ int main() {
     meshTransformation->scale(4);
 
 
-    std::shared_ptr<Gg::Component::Mesh> playerMesh{std::make_shared<Gg::Component::Mesh>(program)};
-    Cube(playerMesh,0.5f,glm::vec3{0.f,0.3f,1.0f});
-    engine.addComponentToEntity(playerID, "MainMesh", std::static_pointer_cast<Gg::Component::AbstractComponent>(playerMesh));
-
-
-    gameScene->addChild(worldID);
-    gameScene->addChild(playerID);
-    playerScene->addChild(cameraID);
-    playerScene->addChild(meshID);
+    Gg::SceneGraph &sceneGraph{engine.getSceneGraph()};
+    sceneGraph.addRoot(gameID);
+    sceneGraph.setParent(worldID, gameID);
+    sceneGraph.setParent(playerID, gameID);
+    sceneGraph.setParent(cameraID, playerID);
+    sceneGraph.setParent(meshID, playerID);
     //INITIALISING LIGHTS
     Gg::Entity light1ID{engine.getNewEntity()};
 
-    std::shared_ptr<Gg::Component::SceneObject> light1Scene{std::make_shared<Gg::Component::SceneObject>()};
-    std::shared_ptr<Gg::Component::Transformation> light1Transformation{std::make_shared<Gg::Component::Transformation>()};
-    std::shared_ptr<Gg::Component::Light> light1Light{std::make_shared<Gg::Component::Light>()};
+    std::shared_ptr<Gg::Component::SceneObject> light1Scene{Gg::makeComponent<Gg::Component::SceneObject>()};
+    std::shared_ptr<Gg::Component::Transformation> light1Transformation{Gg::makeComponent<Gg::Component::Transformation>()};
+    std::shared_ptr<Gg::Component::Light> light1Light{Gg::makeComponent<Gg::Component::Light>()};
 
-    engine.addComponentToEntity(light1ID, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(light1Scene));
-    engine.addComponentToEntity(light1ID, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(light1Transformation));
-    engine.addComponentToEntity(light1ID, "Light", std::static_pointer_cast<Gg::Component::AbstractComponent>(light1Light));
+    engine.addComponentToEntity(light1ID, light1Scene);
+    engine.addComponentToEntity(light1ID, light1Transformation);
+    engine.addComponentToEntity(light1ID, light1Light);
 
     light1Light->m_ambient = glm::vec3{0.75f, 0.75f, 0.75f};
     light1Light->m_diffuse = glm::vec3{1.f, 1.f, 1.f};
@@ -300,28 +336,42 @@ int main() {
     light1Light->m_direction = glm::vec3{0.f, 0.f, -1.f};
     light1Light->m_lightType = Gg::Component::LightType::Directional;
 
-    gameScene->addChild(light1ID);
+    sceneGraph.setParent(light1ID, gameID);
 
     //INITIALISING SYSTEMS
     UpdateScene sceneUpdate{engine};
-    sceneUpdate.addEntity(gameID);
 
     DrawScene sceneDraw{engine};
-    sceneDraw.addEntity(worldID);
-    sceneDraw.addEntity(meshID);
     sceneDraw.setCameraEntity(cameraID);
 
     Physics physics{engine};
-    physics.addEntity(playerID);
 
     Collisions collisions{engine,worldID,explosioneventDescription,stepeventDescription};
-    collisions.addEntity(playerID);
 
     Time time{engine,worldID,explosioneventDescription};
 
+    Terrain terrain{engine};
+
     Lightning lightning{engine, program};
-    lightning.addEntity(light1ID);
-    //lightning.addEntity(light2ID);
+
+    //Entities created or deleted by the systems are applied between simulation and rendering
+    Gg::Systems::Scheduler scheduler{engine.getJobSystem()};
+
+    scheduler.addSystem(collisions);
+    scheduler.addSystem(time);
+    scheduler.addSystem(terrain);
+    scheduler.addSystem(physics);
+    scheduler.addSyncPoint([&]() {
+
+      engine.applyCommands();
+      for(Gg::Entity created : engine.getLastCreatedEntities()){
+
+        if(engine.isAlive(created)) { sceneGraph.setParent(created, gameID); }
+      }
+    });
+    scheduler.addSystem(sceneUpdate);
+    scheduler.addSystem(lightning);
+    scheduler.addSystem(sceneDraw);
 
     glm::mat4 projection{glm::perspective(glm::radians(45.0f), 1200.f / 800.f, 0.1f, 2000.f)};
     //cameraTransformation->setSpecificTransformation(glm::lookAt(glm::vec3{0.f, 0.f, 10.f}, glm::vec3{0.f, 0.f, 0.f}, glm::vec3{0.f, 1.f, 0.f}));
@@ -338,6 +388,10 @@ int main() {
     int gNewState = GLFW_RELEASE;
     int rOldState = GLFW_RELEASE;
     int rNewState = GLFW_RELEASE;
+    int pOldState = GLFW_RELEASE;
+    int pNewState = GLFW_RELEASE;
+    int mOldState = GLFW_RELEASE;
+    int mNewState = GLFW_RELEASE;
     glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
     double oxpos, oypos,xpos, ypos;
@@ -348,6 +402,16 @@ int main() {
     float inten=(-1.f * playerTransformation->getTransformationMatrix()[3][1])/600.f;
     musicInstance->setParameterByName("Intensity", inten);
     musicInstance->setVolume(0.2f);
+
+    //Component allocations of the last frame and of the busiest frame since the last print
+    Gg::AllocationCounters previousAllocations{Gg::getAllocationCounters()}, frameAllocations{0, 0, 0}, peakAllocations{0, 0, 0};
+
+    //Mesh sizes of the chunks of the last frame that remeshed the terrain
+    VoxelMeshStatistics lastRemeshing{0, 0, 0, 0, 0};
+
+    //Mesh bytes sent to the GPU by the busiest frame since the last print
+    size_t peakUploadedBytes{0};
+
     while (!haveToStop) {
         //Event
         oxpos = xpos;
@@ -361,7 +425,7 @@ int main() {
 
         if(oxpos != xpos || oypos != ypos){
           cameraTransformation->rotate(glm::radians(ypos-oypos)*sensi,  glm::vec3{1.f,0.f,0.f});
-          cameraTransformation->rotate(glm::radians(xpos-oxpos)*sensi, glm::vec3{0.f,0.f,1.f}*glm::conjugate(cameraTransformation->m_rotation));
+          cameraTransformation->rotate(glm::radians(xpos-oxpos)*sensi, glm::vec3{0.f,0.f,1.f}*glm::conjugate(cameraTransformation->getRotation()));
           meshTransformation->rotate(glm::radians(xpos-oxpos)*sensi, glm::vec3{0.f,1.f,0.f} );
         }
 
@@ -375,11 +439,11 @@ int main() {
         if(glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS) { playerForces->addForce(glm::vec3{0.f,  0.f,-(2.f*P_acc)} ); }
         if(glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS) { playerForces->addForce(glm::vec3{0.f, 0.f, P_acc} ); }
 
-        if(glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {  glm::vec3 toadd{glm::vec3{0.f, 0.f, P_acc} * cameraTransformation->m_rotation};        toadd[2]=0.f;    playerForces->addForce(toadd);   }
-        if(glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) {glm::vec3 toadd{glm::vec3{0.f, 0.f, -P_acc} * cameraTransformation->m_rotation};        toadd[2]=0.f;    playerForces->addForce(toadd); }
+        if(glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {  glm::vec3 toadd{glm::vec3{0.f, 0.f, P_acc} * cameraTransformation->getRotation()};        toadd[2]=0.f;    playerForces->addForce(toadd);   }
+        if(glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) {glm::vec3 toadd{glm::vec3{0.f, 0.f, -P_acc} * cameraTransformation->getRotation()};        toadd[2]=0.f;    playerForces->addForce(toadd); }
 
-        if(glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS) { glm::vec3 toadd{glm::vec3{P_acc,0.f, 0.f} * cameraTransformation->m_rotation};        toadd[2]=0.f;    playerForces->addForce(toadd);  }
-        if(glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS) {glm::vec3 toadd{glm::vec3{-P_acc,0.f, 0.f } * cameraTransformation->m_rotation};        toadd[2]=0.f;    playerForces->addForce(toadd);  }
+        if(glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS) { glm::vec3 toadd{glm::vec3{P_acc,0.f, 0.f} * cameraTransformation->getRotation()};        toadd[2]=0.f;    playerForces->addForce(toadd);  }
+        if(glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS) {glm::vec3 toadd{glm::vec3{-P_acc,0.f, 0.f } * cameraTransformation->getRotation()};        toadd[2]=0.f;    playerForces->addForce(toadd);  }
 
         if(glfwGetKey(window, GLFW_KEY_B) == GLFW_PRESS) {
 
@@ -420,38 +484,49 @@ int main() {
           std::cout<<"intensity : "<<inten<<std::endl;
         }
 
+        pOldState = pNewState;
+        pNewState = glfwGetKey(window, GLFW_KEY_P) ;
+        //ALLOCATIONS
+        if(pOldState == GLFW_PRESS && pNewState == GLFW_RELEASE ) {
+          std::cout<<"component allocations last frame : "<<frameAllocations.componentAllocations<<" ("<<frameAllocations.heapAllocations<<" from the heap)"<<std::endl;
+          std::cout<<"component allocations busiest frame : "<<peakAllocations.componentAllocations<<" ("<<peakAllocations.heapAllocations<<" from the heap)"<<std::endl;
+          std::cout<<"scene nodes updated last frame : "<<sceneUpdate.getNbUpdatedNodes()<<std::endl;
+          std::cout<<"terrain chunks remeshed last frame : "<<terrain.getNbRemeshedChunks()<<std::endl;
+          std::cout<<"last terrain remeshing : "<<lastRemeshing.nbRemeshedChunks<<" chunks, vertices "<<lastRemeshing.nbVerticesBefore<<" -> "<<lastRemeshing.nbVerticesAfter
+                   <<", indices "<<lastRemeshing.nbIndicesBefore<<" -> "<<lastRemeshing.nbIndicesAfter<<std::endl;
+          const LevelOfDetailStatistics &levelOfDetail{sceneDraw.getLevelOfDetailStatistics()};
+          std::cout<<"terrain chunks per level of detail :";
+          for(unsigned int chunks: levelOfDetail.nbChunks) { std::cout<<" "<<chunks; }
+          std::cout<<", triangles "<<levelOfDetail.nbTriangles<<" ("<<levelOfDetail.nbFullDetailTriangles<<" at full detail)"<<std::endl;
+          std::cout<<"mesh bytes uploaded last frame : "<<sceneDraw.getUploadedBytes()<<", busiest frame : "<<peakUploadedBytes<<std::endl;
+          peakAllocations = Gg::AllocationCounters{0, 0, 0};
+          peakUploadedBytes = 0;
+        }
+
+        mOldState = mNewState;
+        mNewState = glfwGetKey(window, GLFW_KEY_M) ;
+        //TERRAIN MESHING, CULLED OR GREEDY
+        if(mOldState == GLFW_PRESS && mNewState == GLFW_RELEASE ) {
+          VoxelMap &worldMap{engine.getComponent<VoxelMap>(worldID)};
+          const VoxelMeshing meshing{worldMap.getChunkMeshing(0) == VoxelMeshing::Greedy ? VoxelMeshing::Culled : VoxelMeshing::Greedy};
+          for(unsigned int chunk{0}; chunk < worldMap.getNbChunks(); chunk++) { worldMap.setChunkMeshing(chunk, meshing); }
+          std::cout<<"terrain meshing : "<<(meshing == VoxelMeshing::Greedy ? "greedy" : "culled")<<std::endl;
+        }
+
         gOldState = gNewState;
         gNewState = glfwGetKey(window, GLFW_KEY_G) ;
         //GRENADE
         if(gOldState == GLFW_PRESS && gNewState == GLFW_RELEASE ) {
-          Gg::Entity newG{engine.getNewEntity()};
-          std::shared_ptr<Gg::Component::SceneObject> newGScene{std::make_shared<Gg::Component::SceneObject>()};
-          std::shared_ptr<Gg::Component::Transformation> newGTransformation{std::make_shared<Gg::Component::Transformation>()};
-          std::shared_ptr<Gg::Component::Collider> newGCollider{std::make_shared<Gg::Component::Collider>()};
-          std::shared_ptr<Gg::Component::Forces> newGForces{std::make_shared<Gg::Component::Forces>()};
-          std::shared_ptr<Gg::Component::Mesh> newGMesh{std::make_shared<Gg::Component::Mesh>(program)};
-          Cube(newGMesh,0.5f,glm::vec3{1.f,0.f,0.f});
-          std::shared_ptr<Gg::Component::Explosive> newGExp{std::make_shared<Gg::Component::Explosive>(5,TIMER)};
-          std::shared_ptr<Gg::Component::Timer> newGTimer{std::make_shared<Gg::Component::Timer>(5000)};
-
-          newGTransformation->setSpecificTransformation(playerScene->m_globalTransformations);
-          glm::vec3 f {(glm::vec3{0.f, 0.f, 1.f} * cameraTransformation->m_rotation)};
-          f[2] += -1.f;
-          f[0]+=playerForces->velocity[0];
-          f[1]+=playerForces->velocity[1];
-          newGForces->addForce( f);
-          engine.addComponentToEntity(newG, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGScene));
-          engine.addComponentToEntity(newG, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGTransformation));
-          engine.addComponentToEntity(newG, "Collider", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGCollider));
-          engine.addComponentToEntity(newG, "Forces", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGForces));
-          engine.addComponentToEntity(newG, "MainMesh", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGMesh));
-          engine.addComponentToEntity(newG, "Explosive", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGExp));
-          engine.addComponentToEntity(newG, "Timer", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGTimer));
-          gameScene->addChild(newG);
-          sceneDraw.addEntity(newG);
-          physics.addEntity(newG);
-          collisions.addEntity(newG);
-          time.addEntity(newG);
+          std::vector<Gg::Entity> newG{engine.instantiate("Grenade", 1, [&](Gg::PrefabInstance &instance) {
+            instance.get<Gg::Component::Transformation>().setSpecificTransformation(playerScene->m_globalTransformations);
+            glm::vec3 f {(glm::vec3{0.f, 0.f, 1.f} * cameraTransformation->getRotation())};
+            f[2] += -1.f;
+            f[0]+=playerForces->velocity[0];
+            f[1]+=playerForces->velocity[1];
+            instance.get<Gg::Component::Forces>().addForce( f);
+            instance.get<Gg::Component::Timer>().restart();
+          })};
+          sceneGraph.setParent(newG[0], gameID);
           sceneUpdate.applyAlgorithms();
 
         }
@@ -461,31 +536,15 @@ int main() {
         rNewState = glfwGetKey(window, GLFW_KEY_R) ;
         //ROCKET
         if(rOldState == GLFW_PRESS && rNewState == GLFW_RELEASE ) {
-          Gg::Entity newG{engine.getNewEntity()};
-          std::shared_ptr<Gg::Component::SceneObject> newGScene{std::make_shared<Gg::Component::SceneObject>()};
-          std::shared_ptr<Gg::Component::Transformation> newGTransformation{std::make_shared<Gg::Component::Transformation>()};
-          std::shared_ptr<Gg::Component::Collider> newGCollider{std::make_shared<Gg::Component::Collider>()};
-          std::shared_ptr<Gg::Component::Forces> newGForces{std::make_shared<Gg::Component::Forces>(glm::vec3{0.f},0.f,1.f,8.f)};
-          std::shared_ptr<Gg::Component::Mesh> newGMesh{std::make_shared<Gg::Component::Mesh>(program)};
-          Cube(newGMesh,0.5f,glm::vec3{1.f,0.f,0.f});
-          std::shared_ptr<Gg::Component::Explosive> newGExp{std::make_shared<Gg::Component::Explosive>(7,ON_COLLISION)};
-
-          newGTransformation->setSpecificTransformation(playerScene->m_globalTransformations);
-          glm::vec3 f {(glm::vec3{0.f, 0.f, 1.f} * cameraTransformation->m_rotation)};
-          f*=4.f;
-          f[0]+=playerForces->velocity[0];
-          f[1]+=playerForces->velocity[1];
-          newGForces->addForce( f);
-          engine.addComponentToEntity(newG, "SceneObject", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGScene));
-          engine.addComponentToEntity(newG, "Transformations", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGTransformation));
-          engine.addComponentToEntity(newG, "Collider", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGCollider));
-          engine.addComponentToEntity(newG, "Forces", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGForces));
-          engine.addComponentToEntity(newG, "MainMesh", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGMesh));
-          engine.addComponentToEntity(newG, "Explosive", std::static_pointer_cast<Gg::Component::AbstractComponent>(newGExp));
-          gameScene->addChild(newG);
-          sceneDraw.addEntity(newG);
-          physics.addEntity(newG);
-          collisions.addEntity(newG);
+          std::vector<Gg::Entity> newG{engine.instantiate("Rocket", 1, [&](Gg::PrefabInstance &instance) {
+            instance.get<Gg::Component::Transformation>().setSpecificTransformation(playerScene->m_globalTransformations);
+            glm::vec3 f {(glm::vec3{0.f, 0.f, 1.f} * cameraTransformation->getRotation())};
+            f*=4.f;
+            f[0]+=playerForces->velocity[0];
+            f[1]+=playerForces->velocity[1];
+            instance.get<Gg::Component::Forces>().addForce( f);
+          })};
+          sceneGraph.setParent(newG[0], gameID);
           sceneUpdate.applyAlgorithms();
         }
 
@@ -493,86 +552,36 @@ int main() {
 
 
 
-        //Update
-        collisions.applyAlgorithms();
-        time.applyAlgorithms();
-        physics.applyAlgorithms();
-        sceneUpdate.applyAlgorithms();
+        //Update and draw
+
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glClearColor(0.15f, 0.75f, 0.95f, 1.0f);
+
+        scheduler.run();
+        if(terrain.getNbRemeshedChunks() > 0) { lastRemeshing = terrain.getMeshStatistics(); }
 
         //3D LISTENER ATTRIBUTES FOR SPATIALIZED SOUNDS
         FMOD_3D_ATTRIBUTES att3D_;
         att3D_.position = FMOD_VECTOR{playerScene->m_globalTransformations[3][0],playerScene->m_globalTransformations[3][1],playerScene->m_globalTransformations[3][2]};//position
         att3D_.velocity = FMOD_VECTOR{ 0.f,  0.f, 0.f };
-        glm::vec3 f {glm::vec3{0.f,0.f,1.f}*cameraTransformation->m_rotation};   f=glm::normalize(f);
+        glm::vec3 f {glm::vec3{0.f,0.f,1.f}*cameraTransformation->getRotation()};   f=glm::normalize(f);
 
         att3D_.forward = FMOD_VECTOR{ f[0],f[1],f[2]};
-        glm::vec3 u {glm::vec3{0.f,-1.f,0.f}*cameraTransformation->m_rotation};  u=glm::normalize(u);
+        glm::vec3 u {glm::vec3{0.f,-1.f,0.f}*cameraTransformation->getRotation()};  u=glm::normalize(u);
         att3D_.up= FMOD_VECTOR{  u[0],u[1],u[2] };
 
 
         soundSystem->setListenerAttributes(0,&att3D_);
 
-
-        lightning.applyAlgorithms();
-
         soundSystem->update();
 
-
-        //Draw
-
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        glClearColor(0.15f, 0.75f, 0.95f, 1.0f);
-
-        sceneDraw.applyAlgorithms();
-
         glfwSwapBuffers(window);
 
-
-
-
-        //Entities to add/delete at the end of the current frame
-
-        for(Gg::Entity toD : time.toDelete){
-          collisions.deleteEntity(toD);
-          physics.deleteEntity(toD);
-          sceneUpdate.deleteEntity(toD);
-          sceneDraw.deleteEntity(toD);
-          engine.deleteEntity(toD);
-          time.deleteEntity(toD);
-          gameScene->deleteChild(toD);
-        }
-        for(Gg::Entity toD : time.toAdd){
-          collisions.addEntity(toD);
-          physics.addEntity(toD);
-          sceneUpdate.addEntity(toD);
-          sceneDraw.addEntity(toD);
-          time.addEntity(toD);
-          gameScene->addChild(toD);
-        }
-
-        for(Gg::Entity toD : collisions.toDelete){
-          collisions.deleteEntity(toD);
-          physics.deleteEntity(toD);
-          sceneUpdate.deleteEntity(toD);
-          sceneDraw.deleteEntity(toD);
-          engine.deleteEntity(toD);
-          time.deleteEntity(toD);
-          gameScene->deleteChild(toD);
-        }
-        for(Gg::Entity toD : collisions.toAdd){
-          collisions.addEntity(toD);
-          physics.addEntity(toD);
-          sceneUpdate.addEntity(toD);
-          sceneDraw.addEntity(toD);
-          time.addEntity(toD);
-          gameScene->addChild(toD);
-        }
-        if(collisions.toAdd.size()>0 || time.toAdd.size()>0)sceneUpdate.applyAlgorithms();
-        time.toAdd.clear();
-        collisions.toAdd.clear();
-        time.toDelete.clear();
-        collisions.toDelete.clear();
-
+        Gg::AllocationCounters currentAllocations{Gg::getAllocationCounters()};
+        frameAllocations = currentAllocations - previousAllocations;
+        previousAllocations = currentAllocations;
+        if(frameAllocations.componentAllocations > peakAllocations.componentAllocations) { peakAllocations = frameAllocations; }
+        peakUploadedBytes = std::max(peakUploadedBytes, sceneDraw.getUploadedBytes());
 
     }
 